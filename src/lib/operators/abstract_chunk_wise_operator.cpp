@@ -0,0 +1,153 @@
+#include "abstract_chunk_wise_operator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_jobs.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Copies the values of the given rows of a column that was computed within the pipeline
+template <typename T>
+std::shared_ptr<BaseColumn> copy_rows(const BaseColumn& column, const PosList& positions) {
+  std::vector<T> values;
+  values.reserve(positions.size());
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto column_values = value_column->values();
+    for (const auto& row_id : positions) values.push_back(column_values[row_id.chunk_offset]);
+  } else {
+    for (const auto& row_id : positions) values.push_back(type_cast<T>(column[row_id.chunk_offset]));
+  }
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+}  // namespace
+
+Chunk create_reference_chunk(const ChunkWiseInput& input, const std::shared_ptr<const PosList>& positions) {
+  // The chunk of the source table is referenced like any chunk of a table
+  const auto& source_chunk = input.source_table->get_chunk(input.chunk_id);
+  if (&input.chunk == &source_chunk) return create_reference_chunk(input.source_table, positions);
+
+  Chunk chunk;
+
+  // Columns of the same input chunk usually share their position list, which is resolved only once
+  std::unordered_map<const PosList*, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  for (ColumnID column_id{0}; column_id < input.chunk.col_count(); ++column_id) {
+    const auto column = input.chunk.get_column(column_id);
+
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      auto& resolved_pos_list = resolved_pos_lists[reference_column->pos_list().get()];
+      if (!resolved_pos_list) {
+        const auto& input_pos_list = *reference_column->pos_list();
+        auto new_pos_list = std::make_shared<PosList>();
+        new_pos_list->reserve(positions->size());
+        for (const auto& row_id : *positions) new_pos_list->push_back(input_pos_list[row_id.chunk_offset]);
+        resolved_pos_list = std::move(new_pos_list);
+      }
+      chunk.add_column(std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                                         reference_column->referenced_column_id(), resolved_pos_list));
+      continue;
+    }
+
+    // The rows of a column that was passed through from the source chunk are those of the source chunk. The source
+    // column is in memory as long as the input chunk holds it, so evictable source chunks are not loaded.
+    std::optional<ColumnID> source_column_id;
+    for (ColumnID candidate_id{0}; candidate_id < source_chunk.col_count() && !source_column_id; ++candidate_id) {
+      if (source_chunk.get_column_if_resident(candidate_id) == column) source_column_id = candidate_id;
+    }
+    if (source_column_id) {
+      chunk.add_column(std::make_shared<ReferenceColumn>(input.source_table, *source_column_id, positions));
+      continue;
+    }
+
+    resolve_data_type(input.definitions.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      chunk.add_column(copy_rows<ColumnDataType>(*column, *positions));
+    });
+  }
+  return chunk;
+}
+
+AbstractChunkWiseOperator::AbstractChunkWiseOperator(const std::shared_ptr<const AbstractOperator> in)
+    : AbstractOperator(in) {}
+
+std::shared_ptr<const Table> AbstractChunkWiseOperator::_on_execute() {
+  const auto pipeline = _pipeline();
+
+  const auto source_table = pipeline.front()->input_left()->get_output();
+  Assert(source_table, "Input of the pipeline has not been executed");
+
+  // input_tables[i] is the input of pipeline[i]. Except for the source, these tables only hold the column definitions.
+  std::vector<std::shared_ptr<const Table>> input_tables{source_table};
+  for (size_t stage = 1; stage < pipeline.size(); ++stage) {
+    input_tables.push_back(pipeline[stage - 1]->create_output_table(*input_tables.back()));
+  }
+
+  auto output = create_output_table(*input_tables.back());
+
+  const auto chunk_count = source_table->chunk_count();
+  const auto row_limit = row_limit_hint();
+  const auto batch_size = row_limit ? chunk_job_batch_size() : chunk_count.t;
+  std::vector<std::shared_ptr<Chunk>> output_chunks(chunk_count);
+
+  auto output_row_count = uint64_t{0};
+  for (auto batch_begin = ChunkID{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    if (row_limit && output_row_count >= *row_limit) break;
+    const auto batch_end = ChunkID{std::min(batch_begin + batch_size, chunk_count.t)};
+
+    for_each_chunk_in_parallel(*source_table, batch_begin, batch_end, [&](const ChunkID chunk_id) {
+      // The chunk is pinned, so that it stays valid if the source table compresses it meanwhile
+      const auto source_chunk = source_table->get_shared_chunk(chunk_id);
+      // an empty table's chunk might be missing actual columns
+      if (source_chunk->col_count() == 0) return;
+
+      auto chunk = pipeline.front()->execute_chunk({*source_table, *source_chunk, source_table, chunk_id});
+      for (size_t stage = 1; stage < pipeline.size() && chunk; ++stage) {
+        chunk = pipeline[stage]->execute_chunk({*input_tables[stage], *chunk, source_table, chunk_id});
+      }
+      output_chunks[chunk_id] = std::move(chunk);
+    });
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      if (row_limit && output_row_count >= *row_limit) break;
+      if (!output_chunks[chunk_id]) continue;
+
+      output_row_count += output_chunks[chunk_id]->size();
+      output->emplace_chunk(std::move(output_chunks[chunk_id]));
+    }
+  }
+
+  if (output_row_count == 0) _on_empty_output(input_tables.back(), *output);
+
+  return output;
+}
+
+void AbstractChunkWiseOperator::_on_empty_output(const std::shared_ptr<const Table>&, Table&) const {}
+
+std::vector<const AbstractChunkWiseOperator*> AbstractChunkWiseOperator::_pipeline() const {
+  std::vector<const AbstractChunkWiseOperator*> pipeline{this};
+
+  auto input = dynamic_cast<const AbstractChunkWiseOperator*>(_input_left.get());
+  while (input && !input->get_output()) {
+    pipeline.push_back(input);
+    input = dynamic_cast<const AbstractChunkWiseOperator*>(input->input_left().get());
+  }
+
+  std::reverse(pipeline.begin(), pipeline.end());
+  return pipeline;
+}
+
+}  // namespace opossum
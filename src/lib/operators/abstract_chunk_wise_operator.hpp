@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// The input of a chunk-wise operator for one chunk. Outside of a pipeline, the chunk is the chunk of the source table
+// with the given id. Within a pipeline, it is the chunk that the previous operator produced from that source chunk,
+// which is not part of any table.
+struct ChunkWiseInput {
+  // the column definitions of the input, which is the output table of the previous operator (see create_output_table)
+  // within a pipeline. That table holds no rows.
+  const Table& definitions;
+  const Chunk& chunk;
+
+  // the input table of the first operator of the pipeline, and the id of the chunk of it that is processed
+  const std::shared_ptr<const Table>& source_table;
+  const ChunkID chunk_id;
+};
+
+// Creates a chunk with ReferenceColumns for the given rows of the input chunk, which are given as RowIDs with the
+// input's chunk_id. References are resolved to the tables the rows come from, as create_reference_chunk does:
+// ReferenceColumns are resolved to the table they reference, and columns of the source table, e.g., those that a
+// Projection passes through, reference the source table. Only the values of columns that were computed within the
+// pipeline are copied, as there is no table that holds them.
+Chunk create_reference_chunk(const ChunkWiseInput& input, const std::shared_ptr<const PosList>& positions);
+
+// Super class of operators that compute each output chunk from the input chunk at the same position only, such as
+// TableScan and Projection. Chunks are processed in parallel by jobs on the CurrentScheduler and added to the output in
+// order. With a row limit hint, only a batch of chunks is processed at a time so that we can stop once enough rows were
+// produced.
+//
+// Chunk-wise operators are executed as a pipeline: if the input is a chunk-wise operator that has not been executed
+// yet, it is not executed on its own. Instead, every chunk of the first executed input (the source) is passed through
+// all chunk-wise operators above it before the next one is processed, so that no intermediate table is materialized
+// and a chunk's data is still in the cache when the next operator reads it. Only the topmost operator of the pipeline
+// gets an output. Operators reference the rows of the source table, see create_reference_chunk above. Operators that
+// need all rows of their input, such as Sort, break the pipeline, see OperatorTask::make_tasks_from_operator.
+class AbstractChunkWiseOperator : public AbstractOperator {
+ public:
+  explicit AbstractChunkWiseOperator(const std::shared_ptr<const AbstractOperator> in);
+
+  // Returns a table that has the columns of the output, but no rows, for the given input table. Only the column
+  // definitions of the input table are used.
+  virtual std::shared_ptr<Table> create_output_table(const Table& input_table) const = 0;
+
+  // Computes the output for one chunk of the input. Returns nullptr if the chunk produces no rows. This is called
+  // concurrently for different chunks.
+  virtual std::shared_ptr<Chunk> execute_chunk(const ChunkWiseInput& input) const = 0;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Called if no chunk produced any rows, e.g., to add a chunk to the output so that it has columns. The input table
+  // holds no rows if the operator is executed as part of a pipeline.
+  virtual void _on_empty_output(const std::shared_ptr<const Table>& input_table, Table& output) const;
+
+  // Returns the operators that are executed by this one, starting with the one that reads the source
+  std::vector<const AbstractChunkWiseOperator*> _pipeline() const;
+};
+
+}  // namespace opossum
@@ -1,20 +1,177 @@
 #include "abstract_operator.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
+#include <future>
+#include <iomanip>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
+#include "abstract_chunk_wise_operator.hpp"
+#include "result_cache.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/cpu_time.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Returns the output tables of the inputs. Inputs that have not been executed are part of the operator's pipeline
+// (see AbstractChunkWiseOperator), so the table the pipeline reads from is returned instead.
+std::vector<std::shared_ptr<const Table>> executed_input_tables(const AbstractOperator& op) {
+  std::vector<std::shared_ptr<const Table>> tables;
+  for (auto input : {op.input_left(), op.input_right()}) {
+    while (input && !input->get_output()) input = input->input_left();
+    if (input) tables.push_back(input->get_output());
+  }
+  return tables;
+}
+
+uint64_t materialized_bytes(const Table& output, const std::vector<std::shared_ptr<const Table>>& input_tables) {
+  // Only the addresses are kept, so that evictable columns are not kept in memory. Evictable chunks only report the
+  // columns they hold in memory, which includes all columns the output shares with them, so nothing is loaded.
+  std::unordered_set<const Chunk*> input_chunks;
+  std::unordered_set<const BaseColumn*> input_columns;
+  for (const auto& input_table : input_tables) {
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      input_chunks.insert(&chunk);
+      for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+        if (const auto column = chunk.get_column_if_resident(column_id)) input_columns.insert(column.get());
+      }
+    }
+  }
+
+  // The columns of a chunk usually share their position list, which is only counted once
+  std::unordered_set<const PosList*> pos_lists;
+  auto bytes = uint64_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    if (chunk.is_evictable() || input_chunks.count(&chunk)) continue;
+
+    for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+      const auto column = chunk.get_column(column_id);
+      if (input_columns.count(column.get())) continue;
+
+      if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+        if (pos_lists.insert(reference_column->pos_list().get()).second) {
+          bytes += reference_column->estimate_memory_usage();
+        }
+      } else {
+        bytes += column->estimate_memory_usage();
+      }
+    }
+  }
+  return bytes;
+}
+
+void print_operator(const AbstractOperator& op, const size_t depth, const bool is_pipelined, std::ostream& out) {
+  // The line is formatted separately so that the stream's formatting flags are not changed
+  std::ostringstream line;
+  line << std::string(2 * depth, ' ') << op.name() << ": ";
+
+  if (op.get_output()) {
+    const auto& data = op.performance_data();
+    const auto milliseconds = [](const std::chrono::nanoseconds duration) {
+      return std::chrono::duration<double, std::milli>(duration).count();
+    };
+    line << std::fixed << std::setprecision(3) << milliseconds(data.walltime) << " ms wall, "
+         << milliseconds(data.cpu_time) << " ms CPU, " << data.input_row_count << " -> " << data.output_row_count
+         << " rows, " << data.output_chunk_count << (data.output_chunk_count.t == 1 ? " chunk, " : " chunks, ")
+         << data.materialized_bytes << " bytes materialized";
+    if (data.is_cached) line << ", cached";
+  } else if (is_pipelined) {
+    line << "executed in the pipeline of its consumer";
+  } else {
+    line << "not executed";
+  }
+  out << line.str() << std::endl;
+
+  // An input without output was executed as part of this operator's pipeline if this one is chunk-wise and done
+  const auto executes_pipeline =
+      (op.get_output() || is_pipelined) && dynamic_cast<const AbstractChunkWiseOperator*>(&op) != nullptr;
+  for (const auto& input : {op.input_left(), op.input_right()}) {
+    if (input) print_operator(*input, depth + 1, executes_pipeline && !input->get_output(), out);
+  }
+}
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
-    : _input_left(left), _input_right(right) {}
+    : _input_left(left), _input_right(right) {
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input) continue;
+    std::lock_guard<std::mutex> lock(input->_consumers_mutex);
+    input->_consumers.push_back(this);
+  }
+}
+
+AbstractOperator::~AbstractOperator() {
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input) continue;
+    std::lock_guard<std::mutex> lock(input->_consumers_mutex);
+    // An operator that has the same input twice is registered twice and removes one entry per input
+    input->_consumers.erase(std::find(input->_consumers.begin(), input->_consumers.end(), this));
+  }
+}
+
+void AbstractOperator::execute() {
+  // The fingerprint is taken before the execution, so that the output is never cached for table versions it was not
+  // computed from
+  const auto fingerprint = ResultCache::get().capacity() > 0 ? this->fingerprint() : std::nullopt;
+  if (fingerprint && _use_cached_output(*fingerprint)) return;
+
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = thread_cpu_time();
+  JobCpuTime job_cpu_time;
+
+  _output = _on_execute();
+
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  _performance_data.cpu_time = thread_cpu_time() - cpu_time_begin + job_cpu_time.get();
+
+  const auto input_tables = executed_input_tables(*this);
+  for (const auto& input_table : input_tables) _performance_data.input_row_count += input_table->row_count();
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  if (!_returns_existing_table()) _performance_data.materialized_bytes = materialized_bytes(*_output, input_tables);
+
+  if (fingerprint) ResultCache::get().set(*fingerprint, _output);
+}
+
+std::future<std::shared_ptr<const Table>> AbstractOperator::execute_async() {
+  auto promise = std::make_shared<std::promise<std::shared_ptr<const Table>>>();
+  auto future = promise->get_future();
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(shared_from_this());
+  if (tasks.empty()) {
+    promise->set_value(_output);
+    return future;
+  }
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+  // The last task is the one of this operator, it is done once all others are
+  tasks.back()->set_done_callback([promise, op = shared_from_this()](const std::exception_ptr exception) {
+    if (exception) {
+      promise->set_exception(exception);
+    } else {
+      promise->set_value(op->get_output());
+    }
+  });
+
+  CurrentScheduler::schedule_tasks(tasks);
+  return future;
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -22,6 +179,70 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::optional<std::string> AbstractOperator::fingerprint() const {
+  const auto parameters = _parameter_fingerprint();
+  if (!parameters) return std::nullopt;
+
+  auto fingerprint = name() + "(" + *parameters + ")";
+  if (const auto row_limit = row_limit_hint()) fingerprint += "#" + std::to_string(*row_limit);
+
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input) continue;
+
+    const auto input_fingerprint = input->fingerprint();
+    if (!input_fingerprint) return std::nullopt;
+    fingerprint += "[" + *input_fingerprint + "]";
+  }
+  return fingerprint;
+}
+
+bool AbstractOperator::try_use_cached_output() {
+  if (ResultCache::get().capacity() == 0) return false;
+
+  const auto fingerprint = this->fingerprint();
+  return fingerprint && _use_cached_output(*fingerprint);
+}
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+void AbstractOperator::print(std::ostream& out) const { print_operator(*this, 0, false, out); }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+void AbstractOperator::set_row_limit_hint(const uint64_t row_limit) const { _row_limit_hint = row_limit; }
+
+std::optional<uint64_t> AbstractOperator::row_limit_hint() const {
+  if (_row_limit_hint) return _row_limit_hint;
+
+  std::lock_guard<std::mutex> lock(_consumers_mutex);
+  if (_consumers.size() != 1) return std::nullopt;
+  return _consumers.front()->_row_limit_for_input(*this);
+}
+
+std::optional<uint64_t> AbstractOperator::_row_limit_for_input(const AbstractOperator&) const { return std::nullopt; }
+
+std::optional<std::string> AbstractOperator::_parameter_fingerprint() const { return std::nullopt; }
+
+bool AbstractOperator::_returns_existing_table() const { return false; }
+
+bool AbstractOperator::_use_cached_output(const std::string& fingerprint) {
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = thread_cpu_time();
+
+  const auto cached_output = ResultCache::get().try_get(fingerprint);
+  if (!cached_output) return false;
+
+  _output = cached_output;
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  _performance_data.cpu_time = thread_cpu_time() - cpu_time_begin;
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  _performance_data.is_cached = true;
+  return true;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <future>
+#include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -10,13 +15,35 @@ namespace opossum {
 
 class Table;
 
+// Measurements that AbstractOperator::execute takes for every operator
+struct OperatorPerformanceData {
+  std::chrono::nanoseconds walltime{0};
+
+  // CPU time of the executing thread plus that of the operator's jobs on other threads (see
+  // for_each_chunk_in_parallel). If the executing thread runs tasks of other operators while it waits for its jobs,
+  // these are included as well.
+  std::chrono::nanoseconds cpu_time{0};
+
+  // rows of the input tables. For operators that execute a pipeline, these are the rows of its source.
+  uint64_t input_row_count = 0;
+  uint64_t output_row_count = 0;
+  ChunkID output_chunk_count{0};
+
+  // Estimated size of the columns and position lists that the output does not share with the input tables. Evictable
+  // chunks are not counted, as they belong to stored tables, and are never loaded to compute this.
+  uint64_t materialized_bytes = 0;
+
+  // whether the output was taken from the ResultCache instead of being computed
+  bool is_cached = false;
+};
+
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
 // Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
-// 2. The execute method is called from the outside (usually by the scheduler). This is where the heavy lifting is done.
-// By now, the input operators have already executed.
+// 2. The execute method is called from the outside (usually by the scheduler, see OperatorTask). This is where the
+// heavy lifting is done. By now, the input operators have already executed.
 // 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
@@ -24,33 +51,90 @@ class Table;
 //
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
-class AbstractOperator : private Noncopyable {
+class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
  public:
   AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
                    const std::shared_ptr<const AbstractOperator> right = nullptr);
 
-  virtual ~AbstractOperator() = default;
+  virtual ~AbstractOperator();
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  AbstractOperator(AbstractOperator&&) = default;
-  AbstractOperator& operator=(AbstractOperator&&) = default;
+  // Operators register with their inputs as consumers (see row_limit_hint), so they cannot be moved
+  AbstractOperator(AbstractOperator&&) = delete;
+  AbstractOperator& operator=(AbstractOperator&&) = delete;
 
   void execute();
 
+  // Executes the operator and all operators it reads from that have not been executed yet as tasks on the
+  // CurrentScheduler (see OperatorTask) and returns right away. The future provides the output, or the exception of
+  // the first operator that failed, once the operator is done, so that a caller can poll (e.g., with wait_for) or wait
+  // without keeping a thread blocked for each query. Without a scheduler, the operators are executed on the calling
+  // thread before this returns. The operator has to be owned by a shared_ptr. Do not wait for the future from within a
+  // task, as that would block a worker, use CurrentScheduler::wait_for_tasks instead.
+  std::future<std::shared_ptr<const Table>> execute_async();
+
   // returns the result of the operator
   std::shared_ptr<const Table> get_output() const;
 
+  // returns the name of the operator, e.g., "TableScan"
+  virtual const std::string name() const = 0;
+
+  // Returns a string that identifies the output of the operator: operators with equal fingerprints produce equal
+  // outputs, as long as the tables they read have the same versions (see Table::version). It consists of the name, the
+  // parameters (see _parameter_fingerprint), the row limit hint, and the fingerprints of the inputs. Returns nullopt if
+  // the operator or one of its inputs does not support fingerprints. Used as the key of the ResultCache.
+  std::optional<std::string> fingerprint() const;
+
+  // If the ResultCache holds an output for the operator's fingerprint, takes it as the output without executing the
+  // operator and returns true. The inputs do not need to be executed in this case. execute() checks the cache as well.
+  bool try_use_cached_output();
+
+  // returns the measurements of the execution, which are all zero until the operator is executed
+  const OperatorPerformanceData& performance_data() const;
+
+  // Prints the operator and, indented below it, the operators it reads from with their performance data, e.g.:
+  //   Sort: 1.204 ms wall, 2.317 ms CPU, 10 -> 5 rows, 1 chunk, 48 bytes materialized
+  //     TableScan: 0.880 ms wall, 1.950 ms CPU, 10 -> 10 rows, 2 chunks, 104 bytes materialized
+  //       TableWrapper: 0.001 ms wall, 0.001 ms CPU, 0 -> 10 rows, 2 chunks, 0 bytes materialized
+  void print(std::ostream& out = std::cout) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
 
+  // Returns how many rows the consumers of the output are going to read, if they only read the first rows. Chunk-wise
+  // operators then stop processing further chunks once they have produced that many rows and Sort only sorts the top
+  // rows. Operators may still produce more rows than requested. The hint comes from the consumer if the operator has
+  // exactly one, e.g., a Limit, or a Projection whose own consumer reads a limited number of rows. Operators that are
+  // the input of several operators do not get a hint, as the consumers may need different numbers of rows.
+  std::optional<uint64_t> row_limit_hint() const;
+
+  // Sets the row limit hint explicitly, regardless of the consumers. Whoever builds the plan may use this if they know
+  // that no consumer needs more rows. Hints set after the execution have no effect. It is const so that it can be
+  // called on the inputs of an operator.
+  void set_row_limit_hint(const uint64_t row_limit) const;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // Returns everything besides the inputs that determines the output, e.g., the scan column and value, encoded using
+  // fingerprint_string and fingerprint_value (see ResultCache). The default returns nullopt, so operators that do not
+  // override it, e.g., because they have side effects, are never cached.
+  virtual std::optional<std::string> _parameter_fingerprint() const;
+
+  // Returns the number of rows this operator is going to read from the given input if it only reads the first rows,
+  // see row_limit_hint. Defaults to nullopt.
+  virtual std::optional<uint64_t> _row_limit_for_input(const AbstractOperator& input) const;
+
+  // Returns whether the output is a table that existed before the execution, e.g., one of the StorageManager, so that
+  // none of it counts as materialized. Defaults to false.
+  virtual bool _returns_existing_table() const;
+
+  // takes the output from the ResultCache if it holds one for the given fingerprint
+  bool _use_cached_output(const std::string& fingerprint);
+
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
@@ -60,6 +144,15 @@ class AbstractOperator : private Noncopyable {
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  // Number of rows the consumers are going to read if it was set explicitly, see set_row_limit_hint
+  mutable std::optional<uint64_t> _row_limit_hint;
+
+  // Operators that have this one as an input, registered by their constructors and removed by their destructors
+  mutable std::vector<const AbstractOperator*> _consumers;
+  mutable std::mutex _consumers_mutex;
+
+  OperatorPerformanceData _performance_data;
 };
 
 }  // namespace opossum
@@ -0,0 +1,28 @@
+#include "export_binary.hpp"
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "storage/binary_table_file.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name)
+    : AbstractOperator(in), _file_name(file_name) {}
+
+const std::string ExportBinary::name() const { return "ExportBinary"; }
+
+std::shared_ptr<const Table> ExportBinary::_on_execute() {
+  const auto table = _input_table_left();
+
+  std::ofstream out(_file_name, std::ios::binary);
+  Assert(out.is_open(), "ExportBinary: Could not open file " + _file_name);
+  write_binary_table(*table, out);
+
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Writes its input table to a binary table file (see binary_table_file.hpp), from which ImportBinary loads it much
+// faster than load_table from a .tbl file. The output is the input table.
+class ExportBinary : public AbstractOperator {
+ public:
+  ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+};
+
+}  // namespace opossum
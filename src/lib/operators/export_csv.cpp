@@ -0,0 +1,151 @@
+#include "export_csv.hpp"
+
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/c_locale.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The text is written to the stream whenever the buffer holds more than this
+constexpr auto output_buffer_size = size_t{4} * 1024 * 1024;
+
+void append_field(std::string& text, const std::string& value) {
+  if (value.find_first_of(",\"\r\n") == std::string::npos) {
+    text += value;
+    return;
+  }
+
+  text += '"';
+  for (const auto character : value) {
+    if (character == '"') text += '"';
+    text += character;
+  }
+  text += '"';
+}
+
+// Writes a number into the buffer and returns its length. With std::to_chars, which supports floating-point numbers
+// from GCC 11 on, they get as few digits as are needed to read the same value back. Otherwise, they are written with
+// the maximum number of digits that may be needed, which the caller does in the "C" locale (see ScopedCLocale).
+template <typename T>
+int format_number(char* buffer, const size_t size, const T value) {
+#if defined(__cpp_lib_to_chars)
+  const auto result = std::to_chars(buffer, buffer + size, value);
+  return result.ec == std::errc() ? static_cast<int>(result.ptr - buffer) : -1;
+#else
+  if constexpr (std::is_same_v<T, int32_t>) {
+    return std::snprintf(buffer, size, "%" PRId32, value);
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return std::snprintf(buffer, size, "%" PRId64, value);
+  } else {
+    return std::snprintf(buffer, size, std::is_same_v<T, float> ? "%.9g" : "%.17g", static_cast<double>(value));
+  }
+#endif
+}
+
+// Formats all values of a column into one text and records where the value of each row ends, so that the rows can be
+// put together from the columns by copying
+template <typename T>
+void format_column(const BaseColumn& column, std::string& text, std::vector<size_t>& value_ends) {
+  const auto values = materialize_values<T>(column);
+  text.clear();
+  value_ends.clear();
+  value_ends.reserve(values.size());
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      append_field(text, value);
+      value_ends.push_back(text.size());
+    }
+  } else {
+    // enough for any number with the precision used by format_number
+    char buffer[32];
+#if !defined(__cpp_lib_to_chars)
+    const ScopedCLocale c_locale;
+#endif
+    for (const auto& value : values) {
+      const auto length = format_number(buffer, sizeof(buffer), value);
+      DebugAssert(length > 0 && static_cast<size_t>(length) < sizeof(buffer), "Could not format value");
+      text.append(buffer, length);
+      value_ends.push_back(text.size());
+    }
+  }
+}
+
+}  // namespace
+
+ExportCsv::ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name)
+    : AbstractOperator(in), _file_name(file_name) {}
+
+const std::string ExportCsv::name() const { return "ExportCsv"; }
+
+void ExportCsv::write(const Table& table, std::ostream& out) {
+  std::string buffer;
+  buffer.reserve(output_buffer_size);
+
+  for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+    if (column_id > 0) buffer += ',';
+    append_field(buffer, table.column_name(column_id));
+  }
+  buffer += '\n';
+
+  std::vector<std::string> column_texts(table.col_count());
+  std::vector<std::vector<size_t>> column_value_ends(table.col_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_shared_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        format_column<ColumnDataType>(*chunk->get_column(column_id), column_texts[column_id],
+                                      column_value_ends[column_id]);
+      });
+    }
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
+      for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+        if (column_id > 0) buffer += ',';
+        const auto& value_ends = column_value_ends[column_id];
+        const auto value_begin = chunk_offset == 0 ? size_t{0} : value_ends[chunk_offset - 1];
+        buffer.append(column_texts[column_id], value_begin, value_ends[chunk_offset] - value_begin);
+      }
+      buffer += '\n';
+
+      if (buffer.size() >= output_buffer_size) {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+      }
+    }
+  }
+
+  out.write(buffer.data(), buffer.size());
+  Assert(out.good(), "ExportCsv: Could not write the table");
+}
+
+std::shared_ptr<const Table> ExportCsv::_on_execute() {
+  const auto table = _input_table_left();
+
+  std::ofstream out(_file_name, std::ios::binary);
+  Assert(out.is_open(), "ExportCsv: Could not open file " + _file_name);
+  write(*table, out);
+
+  return table;
+}
+
+}  // namespace opossum
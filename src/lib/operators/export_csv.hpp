@@ -0,0 +1,32 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Writes its input table to a CSV file with a header of the column names, e.g., for systems that cannot read the
+// binary format of ExportBinary. Strings are quoted if they contain a comma, a quote, or a line break (RFC 4180).
+// The table is formatted chunk by chunk and column by column without going through AllTypeVariant, floating-point
+// numbers with enough digits to read them back exactly, and the text is written through a large buffer, so that
+// millions of rows can be exported quickly. Numbers are always written with a decimal point, whatever the locale.
+// The output is the input table.
+class ExportCsv : public AbstractOperator {
+ public:
+  ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name);
+
+  // writes the table as CSV to the stream, as the operator does to its file
+  static void write(const Table& table, std::ostream& out);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+};
+
+}  // namespace opossum
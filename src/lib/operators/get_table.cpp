@@ -0,0 +1,30 @@
+#include "get_table.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "result_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+GetTable::GetTable(const std::string& name) : _name(name) {}
+
+const std::string GetTable::name() const { return "GetTable"; }
+
+const std::string& GetTable::table_name() const { return _name; }
+
+std::shared_ptr<const Table> GetTable::_on_execute() { return StorageManager::get().get_table(_name); }
+
+std::optional<std::string> GetTable::_parameter_fingerprint() const {
+  // Without a table, there is no output to cache. Versions are unique across tables, so a table that was replaced under
+  // the same name gets a different fingerprint.
+  auto& storage_manager = StorageManager::get();
+  if (!storage_manager.has_table(_name)) return std::nullopt;
+  return fingerprint_string(_name) + "@" + std::to_string(storage_manager.get_table(_name)->version());
+}
+
+bool GetTable::_returns_existing_table() const { return true; }
+
+}  // namespace opossum
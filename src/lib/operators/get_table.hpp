@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,7 +16,13 @@ class GetTable : public AbstractOperator {
 
   const std::string& table_name() const;
 
+  const std::string name() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+  bool _returns_existing_table() const override;
+
+  const std::string _name;
 };
 }  // namespace opossum
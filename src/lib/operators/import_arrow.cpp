@@ -0,0 +1,24 @@
+#include "import_arrow.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "storage/arrow_ipc_file.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+ImportArrow::ImportArrow(const std::string& file_name, const std::optional<std::string>& table_name)
+    : _file_name(file_name), _table_name(table_name) {}
+
+const std::string ImportArrow::name() const { return "ImportArrow"; }
+
+std::shared_ptr<const Table> ImportArrow::_on_execute() {
+  const auto table = read_arrow_ipc_file(_file_name);
+  if (_table_name) StorageManager::get().add_table(*_table_name, table);
+
+  return table;
+}
+
+}  // namespace opossum
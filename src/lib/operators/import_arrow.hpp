@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Loads a table from an Arrow IPC file (see read_arrow_ipc_file), e.g., one written by another system. If a table name
+// is given, the table is also added to the StorageManager.
+class ImportArrow : public AbstractOperator {
+ public:
+  explicit ImportArrow(const std::string& file_name, const std::optional<std::string>& table_name = std::nullopt);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const std::optional<std::string> _table_name;
+};
+
+}  // namespace opossum
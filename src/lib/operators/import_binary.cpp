@@ -0,0 +1,34 @@
+#include "import_binary.hpp"
+
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "storage/binary_table_file.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ImportBinary::ImportBinary(const std::string& file_name, const std::optional<std::string>& table_name,
+                           const ImportMode mode)
+    : _file_name(file_name), _table_name(table_name), _mode(mode) {}
+
+const std::string ImportBinary::name() const { return "ImportBinary"; }
+
+std::shared_ptr<const Table> ImportBinary::_on_execute() {
+  std::shared_ptr<Table> table;
+  if (_mode == ImportMode::Map) {
+    table = map_binary_table(_file_name);
+  } else {
+    std::ifstream in(_file_name, std::ios::binary);
+    Assert(in.is_open(), "ImportBinary: Could not open file " + _file_name);
+    table = read_binary_table(in);
+  }
+  if (_table_name) StorageManager::get().add_table(*_table_name, table);
+
+  return table;
+}
+
+}  // namespace opossum
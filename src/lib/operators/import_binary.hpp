@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Loads a table from a binary table file written by ExportBinary. If a table name is given, the table is also added to
+// the StorageManager. With ImportMode::Map, the file is mapped into memory instead of read (see map_binary_table).
+enum class ImportMode { Read, Map };
+
+class ImportBinary : public AbstractOperator {
+ public:
+  explicit ImportBinary(const std::string& file_name, const std::optional<std::string>& table_name = std::nullopt,
+                        const ImportMode mode = ImportMode::Read);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const std::optional<std::string> _table_name;
+  const ImportMode _mode;
+};
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const uint64_t num_rows)
+    : AbstractOperator(in), _num_rows(num_rows) {}
+
+const std::string Limit::name() const { return "Limit"; }
+
+uint64_t Limit::num_rows() const { return _num_rows; }
+
+std::optional<uint64_t> Limit::_row_limit_for_input(const AbstractOperator&) const { return _num_rows; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  auto remaining_row_count = _num_rows;
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count() && remaining_row_count > 0; ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id).size();
+    if (chunk_size == 0) continue;
+
+    const auto output_chunk_size = static_cast<ChunkOffset>(std::min<uint64_t>(chunk_size, remaining_row_count));
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(output_chunk_size);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_size; ++chunk_offset) {
+      pos_list->push_back(RowID{chunk_id, chunk_offset});
+    }
+
+    output->emplace_chunk(create_reference_chunk(input_table, pos_list));
+    remaining_row_count -= output_chunk_size;
+  }
+
+  // Even if no rows are returned, the output should have columns
+  if (remaining_row_count == _num_rows) {
+    output->emplace_chunk(create_reference_chunk(input_table, std::make_shared<PosList>()));
+  }
+
+  return output;
+}
+
+std::optional<std::string> Limit::_parameter_fingerprint() const { return std::to_string(_num_rows); }
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that returns the first `num_rows` rows of its input as ReferenceColumns. It only touches as many input
+// chunks as needed and announces the number of rows it is going to read to its input (see row_limit_hint), so that,
+// e.g., a TableScan below it stops after the first matches instead of scanning the entire table. This only applies if
+// the Limit is the input's only consumer.
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const uint64_t num_rows);
+
+  uint64_t num_rows() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+  std::optional<uint64_t> _row_limit_for_input(const AbstractOperator& input) const override;
+
+  const uint64_t _num_rows;
+};
+
+}  // namespace opossum
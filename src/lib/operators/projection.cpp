@@ -0,0 +1,61 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::vector<std::shared_ptr<ProjectionExpression>> column_expressions(const std::vector<ColumnID>& column_ids) {
+  std::vector<std::shared_ptr<ProjectionExpression>> expressions;
+  expressions.reserve(column_ids.size());
+  for (const auto& column_id : column_ids) expressions.push_back(ProjectionExpression::create_column(column_id));
+  return expressions;
+}
+
+}  // namespace
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<std::shared_ptr<ProjectionExpression>>& expressions)
+    : AbstractChunkWiseOperator(in), _expressions(expressions) {}
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids)
+    : Projection(in, column_expressions(column_ids)) {}
+
+const std::string Projection::name() const { return "Projection"; }
+
+const std::vector<std::shared_ptr<ProjectionExpression>>& Projection::expressions() const { return _expressions; }
+
+std::optional<uint64_t> Projection::_row_limit_for_input(const AbstractOperator&) const { return row_limit_hint(); }
+
+std::shared_ptr<Table> Projection::create_output_table(const Table& input_table) const {
+  auto output = std::make_shared<Table>();
+  for (const auto& expression : _expressions) {
+    output->add_column_definition(expression->column_name(input_table), expression->data_type(input_table));
+  }
+  return output;
+}
+
+std::shared_ptr<Chunk> Projection::execute_chunk(const ChunkWiseInput& input) const {
+  auto output_chunk = std::make_shared<Chunk>();
+  for (const auto& expression : _expressions) {
+    output_chunk->add_column(expression->evaluate(input.definitions, input.chunk));
+  }
+  return output_chunk;
+}
+
+std::optional<std::string> Projection::_parameter_fingerprint() const {
+  std::string fingerprint;
+  for (const auto& expression : _expressions) fingerprint += expression->fingerprint() + ",";
+  return fingerprint;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_chunk_wise_operator.hpp"
+#include "projection_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that computes one output column per expression. Columns of the input that are only selected are passed
+// through as they are, i.e., the output chunks share the ValueColumns, DictionaryColumns, and ReferenceColumns of the
+// input chunks and no values are copied. Computed columns (e.g., `a * b + c`) are written into new ValueColumns, see
+// ProjectionExpression. Chunks are computed in parallel by jobs on the CurrentScheduler and can be pipelined with other
+// chunk-wise operators, see AbstractChunkWiseOperator. As the rows are not changed, a row limit hint is forwarded to
+// the input.
+class Projection : public AbstractChunkWiseOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in,
+             const std::vector<std::shared_ptr<ProjectionExpression>>& expressions);
+
+  // selects and reorders the given columns
+  Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids);
+
+  const std::vector<std::shared_ptr<ProjectionExpression>>& expressions() const;
+
+  std::shared_ptr<Table> create_output_table(const Table& input_table) const override;
+  std::shared_ptr<Chunk> execute_chunk(const ChunkWiseInput& input) const override;
+
+  const std::string name() const override;
+
+ protected:
+  std::optional<std::string> _parameter_fingerprint() const override;
+  // Projection keeps the rows of its input, so its input needs as many rows as its consumer
+  std::optional<uint64_t> _row_limit_for_input(const AbstractOperator& input) const override;
+
+  const std::vector<std::shared_ptr<ProjectionExpression>> _expressions;
+};
+
+}  // namespace opossum
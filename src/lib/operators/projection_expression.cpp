@@ -0,0 +1,394 @@
+#include "projection_expression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "result_cache.hpp"
+#include "storage/materialize.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Arithmetic operators produce the type that comes later in this list
+const std::vector<std::string> arithmetic_types{"int", "long", "float", "double"};
+
+std::string promote_types(const std::string& left_type, const std::string& right_type) {
+  const auto left = std::find(arithmetic_types.cbegin(), arithmetic_types.cend(), left_type);
+  const auto right = std::find(arithmetic_types.cbegin(), arithmetic_types.cend(), right_type);
+  Assert(left != arithmetic_types.cend() && right != arithmetic_types.cend(),
+         "Arithmetic operators are not supported for " + left_type + " and " + right_type);
+  return *std::max(left, right);
+}
+
+std::string type_of_value(const AllTypeVariant& value) {
+  std::string type;
+  hana::for_each(column_types, [&](auto x) {
+    using ValueDataType = typename decltype(+hana::second(x))::type;
+    if (boost::get<ValueDataType>(&value)) type = hana::first(x);
+  });
+  return type;
+}
+
+std::string operator_symbol(const ExpressionType type) {
+  switch (type) {
+    case ExpressionType::Addition:
+      return "+";
+    case ExpressionType::Subtraction:
+      return "-";
+    case ExpressionType::Multiplication:
+      return "*";
+    case ExpressionType::Division:
+      return "/";
+    case ExpressionType::Modulo:
+      return "%";
+    default:
+      Fail("Expression is not an arithmetic operator");
+      return "";
+  }
+}
+
+// The values of an expression for one chunk. This is either a single value that holds for all rows (for literals and
+// expressions on literals only) or one value per row. The values of input ValueColumns are used without copying them.
+template <typename T>
+struct ExpressionResult {
+  Span<T> values() const { return input_column ? input_column->values() : Span<T>{computed_values}; }
+
+  std::optional<T> scalar;
+  std::shared_ptr<const ValueColumn<T>> input_column;
+  std::vector<T> computed_values;
+};
+
+// The operators record whether an integer operation overflowed instead of relying on undefined behavior. Overflowing
+// rows still get a value, so that the loops in apply_operator do not branch; the result is rejected afterwards.
+template <typename T>
+struct Addition {
+  T operator()(const T lhs, const T rhs, bool& overflow) const {
+    if constexpr (std::is_integral_v<T>) {
+      T result;
+      overflow |= __builtin_add_overflow(lhs, rhs, &result);
+      return result;
+    } else {
+      return lhs + rhs;
+    }
+  }
+};
+
+template <typename T>
+struct Subtraction {
+  T operator()(const T lhs, const T rhs, bool& overflow) const {
+    if constexpr (std::is_integral_v<T>) {
+      T result;
+      overflow |= __builtin_sub_overflow(lhs, rhs, &result);
+      return result;
+    } else {
+      return lhs - rhs;
+    }
+  }
+};
+
+template <typename T>
+struct Multiplication {
+  T operator()(const T lhs, const T rhs, bool& overflow) const {
+    if constexpr (std::is_integral_v<T>) {
+      T result;
+      overflow |= __builtin_mul_overflow(lhs, rhs, &result);
+      return result;
+    } else {
+      return lhs * rhs;
+    }
+  }
+};
+
+// Dividing the minimum integer by -1 overflows, for both / and %. Divisors of zero are rejected by check_divisor.
+template <typename T>
+struct Division {
+  T operator()(const T lhs, const T rhs, bool& overflow) const {
+    if constexpr (std::is_integral_v<T>) {
+      const auto minus_one = rhs == T{-1};
+      overflow |= minus_one && lhs == std::numeric_limits<T>::min();
+      return minus_one ? static_cast<T>(-static_cast<std::make_unsigned_t<T>>(lhs)) : lhs / rhs;
+    } else {
+      return lhs / rhs;
+    }
+  }
+};
+
+template <typename T>
+struct Modulo {
+  T operator()(const T lhs, const T rhs, bool& overflow) const {
+    if constexpr (std::is_integral_v<T>) {
+      const auto minus_one = rhs == T{-1};
+      overflow |= minus_one && lhs == std::numeric_limits<T>::min();
+      return minus_one ? T{0} : lhs % rhs;
+    } else {
+      return std::fmod(lhs, rhs);
+    }
+  }
+};
+
+// Unlike for floating point numbers, an integer division by zero is undefined behavior and has to be caught
+template <typename T>
+void check_divisor(const ExpressionResult<T>& divisor) {
+  if constexpr (std::is_integral_v<T>) {
+    const auto values = divisor.values();
+    const auto has_zero =
+        divisor.scalar ? *divisor.scalar == 0 : std::find(values.cbegin(), values.cend(), T{0}) != values.cend();
+    Assert(!has_zero, "Integer division by zero");
+  }
+}
+
+// Applies func to all rows. The loops only contain the typed operation so that the compiler can vectorize them.
+// Integer overflows are rejected once all rows are computed.
+template <typename T, typename Functor>
+ExpressionResult<T> apply_operator(const ExpressionResult<T>& left, const ExpressionResult<T>& right,
+                                   const Functor& func) {
+  ExpressionResult<T> result;
+  auto overflow = false;
+
+  if (left.scalar && right.scalar) {
+    result.scalar = func(*left.scalar, *right.scalar, overflow);
+  } else if (left.scalar) {
+    const auto lhs = *left.scalar;
+    const auto rhs = right.values();
+    auto& output = result.computed_values;
+    output.resize(rhs.size());
+    for (size_t row = 0; row < rhs.size(); ++row) output[row] = func(lhs, rhs[row], overflow);
+  } else if (right.scalar) {
+    const auto lhs = left.values();
+    const auto rhs = *right.scalar;
+    auto& output = result.computed_values;
+    output.resize(lhs.size());
+    for (size_t row = 0; row < lhs.size(); ++row) output[row] = func(lhs[row], rhs, overflow);
+  } else {
+    const auto lhs = left.values();
+    const auto rhs = right.values();
+    DebugAssert(lhs.size() == rhs.size(), "Operands have a different number of rows");
+    auto& output = result.computed_values;
+    output.resize(lhs.size());
+    for (size_t row = 0; row < lhs.size(); ++row) output[row] = func(lhs[row], rhs[row], overflow);
+  }
+
+  if (overflow) Fail("Integer overflow");
+  return result;
+}
+
+template <typename Target, typename Source>
+ExpressionResult<Target> convert_result(const ExpressionResult<Source>& source) {
+  ExpressionResult<Target> result;
+  if (source.scalar) {
+    result.scalar = static_cast<Target>(*source.scalar);
+  } else {
+    const auto values = source.values();
+    result.computed_values.assign(values.cbegin(), values.cend());
+  }
+  return result;
+}
+
+// Uses the values of a ValueColumn in place and materializes all other columns
+template <typename T>
+ExpressionResult<T> column_values(const std::shared_ptr<BaseColumn>& column) {
+  ExpressionResult<T> result;
+  result.input_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column);
+  if (!result.input_column) result.computed_values = materialize_values<T>(*column);
+  return result;
+}
+
+template <typename T>
+ExpressionResult<T> evaluate_as(const ProjectionExpression& expression, const Table& table, const Chunk& chunk);
+
+// Evaluates both operands in T, which is the type of the operator, and applies the operator
+template <typename T>
+ExpressionResult<T> evaluate_operator(const ProjectionExpression& expression, const Table& table, const Chunk& chunk) {
+  const auto left = evaluate_as<T>(*expression.left(), table, chunk);
+  const auto right = evaluate_as<T>(*expression.right(), table, chunk);
+
+  switch (expression.type()) {
+    case ExpressionType::Addition:
+      return apply_operator(left, right, Addition<T>{});
+    case ExpressionType::Subtraction:
+      return apply_operator(left, right, Subtraction<T>{});
+    case ExpressionType::Multiplication:
+      return apply_operator(left, right, Multiplication<T>{});
+    case ExpressionType::Division:
+      check_divisor(right);
+      return apply_operator(left, right, Division<T>{});
+    case ExpressionType::Modulo:
+      check_divisor(right);
+      return apply_operator(left, right, Modulo<T>{});
+    default:
+      Fail("Expression is not an arithmetic operator");
+      return {};
+  }
+}
+
+// Evaluates an expression and converts its values to T, which is the type expected by the parent expression. Each
+// operator is computed in its own type first, so that, e.g., in `a / b + 0.5` with int columns a and b, the division
+// still is an integer division.
+template <typename T>
+ExpressionResult<T> evaluate_as(const ProjectionExpression& expression, const Table& table, const Chunk& chunk) {
+  ExpressionResult<T> result;
+
+  if (expression.type() == ExpressionType::Literal) {
+    result.scalar = type_cast<T>(expression.value());
+    return result;
+  }
+
+  const auto data_type = expression.data_type(table);
+
+  if (expression.type() == ExpressionType::Column) {
+    const auto column = chunk.get_column(expression.column_id());
+
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, T>) {
+        result = column_values<T>(column);
+      } else if constexpr (std::is_arithmetic_v<ColumnDataType> && std::is_arithmetic_v<T>) {
+        result = convert_result<T>(column_values<ColumnDataType>(column));
+      } else {
+        Fail("Cannot convert column of type " + data_type);
+      }
+    });
+    return result;
+  }
+
+  resolve_data_type(data_type, [&](auto type) {
+    using OperatorDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_arithmetic_v<OperatorDataType> && std::is_same_v<OperatorDataType, T>) {
+      result = evaluate_operator<T>(expression, table, chunk);
+    } else if constexpr (std::is_arithmetic_v<OperatorDataType> && std::is_arithmetic_v<T>) {
+      result = convert_result<T>(evaluate_operator<OperatorDataType>(expression, table, chunk));
+    } else {
+      Fail("Arithmetic operators are not supported for " + data_type);
+    }
+  });
+  return result;
+}
+
+}  // namespace
+
+ProjectionExpression::ProjectionExpression(const ExpressionType type, const ColumnID column_id,
+                                           const AllTypeVariant& value,
+                                           const std::shared_ptr<ProjectionExpression>& left,
+                                           const std::shared_ptr<ProjectionExpression>& right,
+                                           const std::optional<std::string>& alias)
+    : _type(type), _column_id(column_id), _value(value), _left(left), _right(right), _alias(alias) {}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::create_column(const ColumnID column_id,
+                                                                          const std::optional<std::string>& alias) {
+  return std::shared_ptr<ProjectionExpression>(
+      new ProjectionExpression(ExpressionType::Column, column_id, AllTypeVariant{}, nullptr, nullptr, alias));
+}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::create_literal(const AllTypeVariant& value,
+                                                                           const std::optional<std::string>& alias) {
+  return std::shared_ptr<ProjectionExpression>(
+      new ProjectionExpression(ExpressionType::Literal, ColumnID{0}, value, nullptr, nullptr, alias));
+}
+
+std::shared_ptr<ProjectionExpression> ProjectionExpression::create_binary_operator(
+    const ExpressionType type, const std::shared_ptr<ProjectionExpression>& left,
+    const std::shared_ptr<ProjectionExpression>& right, const std::optional<std::string>& alias) {
+  Assert(type != ExpressionType::Column && type != ExpressionType::Literal, "Expected an arithmetic operator");
+  Assert(left && right, "Arithmetic operators need two operands");
+  return std::shared_ptr<ProjectionExpression>(
+      new ProjectionExpression(type, ColumnID{0}, AllTypeVariant{}, left, right, alias));
+}
+
+ExpressionType ProjectionExpression::type() const { return _type; }
+
+ColumnID ProjectionExpression::column_id() const { return _column_id; }
+
+const AllTypeVariant& ProjectionExpression::value() const { return _value; }
+
+const std::shared_ptr<ProjectionExpression>& ProjectionExpression::left() const { return _left; }
+
+const std::shared_ptr<ProjectionExpression>& ProjectionExpression::right() const { return _right; }
+
+const std::optional<std::string>& ProjectionExpression::alias() const { return _alias; }
+
+std::string ProjectionExpression::column_name(const Table& table) const {
+  if (_alias) return *_alias;
+  return _description(table);
+}
+
+std::string ProjectionExpression::_description(const Table& table) const {
+  switch (_type) {
+    case ExpressionType::Column:
+      return table.column_name(_column_id);
+    case ExpressionType::Literal:
+      return type_of_value(_value) == "string" ? "'" + type_cast<std::string>(_value) + "'"
+                                               : type_cast<std::string>(_value);
+    default: {
+      // Nested operators are put in parentheses so that the name reflects the evaluation order
+      const auto operand_name = [&](const ProjectionExpression& operand) {
+        const auto is_operator = operand._type != ExpressionType::Column && operand._type != ExpressionType::Literal;
+        if (is_operator && !operand._alias) return "(" + operand._description(table) + ")";
+        return operand.column_name(table);
+      };
+      return operand_name(*_left) + " " + operator_symbol(_type) + " " + operand_name(*_right);
+    }
+  }
+}
+
+std::string ProjectionExpression::data_type(const Table& table) const {
+  switch (_type) {
+    case ExpressionType::Column:
+      Assert(_column_id < table.col_count(), "Projected column does not exist");
+      return table.column_type(_column_id);
+    case ExpressionType::Literal:
+      return type_of_value(_value);
+    default:
+      return promote_types(_left->data_type(table), _right->data_type(table));
+  }
+}
+
+std::string ProjectionExpression::fingerprint() const {
+  std::string fingerprint;
+  switch (_type) {
+    case ExpressionType::Column:
+      fingerprint = "column " + std::to_string(_column_id.t);
+      break;
+    case ExpressionType::Literal:
+      fingerprint = "literal " + fingerprint_value(_value);
+      break;
+    default:
+      fingerprint = "(" + _left->fingerprint() + " " + operator_symbol(_type) + " " + _right->fingerprint() + ")";
+  }
+  if (_alias) fingerprint += " as " + fingerprint_string(*_alias);
+  return fingerprint;
+}
+
+std::shared_ptr<BaseColumn> ProjectionExpression::evaluate(const Table& table, const Chunk& chunk) const {
+  if (_type == ExpressionType::Column) return chunk.get_column(_column_id);
+
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(data_type(table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+
+    auto result = evaluate_as<ExpressionDataType>(*this, table, chunk);
+    DebugAssert(!result.input_column, "Only column expressions can return input values");
+
+    auto values = std::move(result.computed_values);
+    if (result.scalar) values.assign(chunk.size(), *result.scalar);
+
+    column = std::make_shared<ValueColumn<ExpressionDataType>>(std::move(values));
+  });
+  return column;
+}
+
+}  // namespace opossum
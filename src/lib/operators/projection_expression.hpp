@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+class Table;
+
+enum class ExpressionType { Column, Literal, Addition, Subtraction, Multiplication, Division, Modulo };
+
+// Describes a single output column of a Projection. An expression is either a column of the input table, a literal,
+// or an arithmetic operator applied to two other expressions, e.g., `a * b + c`.
+//
+// Expressions are evaluated chunk by chunk. Data types are resolved once per chunk, after which the values are
+// computed by typed loops over ValueColumn::values() that the compiler can vectorize. Columns of other types are
+// materialized first. The result type of an arithmetic operator is the wider of its operand types in the order int,
+// long, float, double, i.e., the order of the column types that type_cast converts between. Arithmetic on strings is
+// not supported. Integer operations that overflow in their result type, including the minimum value divided by -1, and
+// integer divisions by zero throw.
+class ProjectionExpression {
+ public:
+  static std::shared_ptr<ProjectionExpression> create_column(const ColumnID column_id,
+                                                             const std::optional<std::string>& alias = std::nullopt);
+
+  static std::shared_ptr<ProjectionExpression> create_literal(const AllTypeVariant& value,
+                                                              const std::optional<std::string>& alias = std::nullopt);
+
+  static std::shared_ptr<ProjectionExpression> create_binary_operator(
+      const ExpressionType type, const std::shared_ptr<ProjectionExpression>& left,
+      const std::shared_ptr<ProjectionExpression>& right, const std::optional<std::string>& alias = std::nullopt);
+
+  ExpressionType type() const;
+  ColumnID column_id() const;
+  const AllTypeVariant& value() const;
+  const std::shared_ptr<ProjectionExpression>& left() const;
+  const std::shared_ptr<ProjectionExpression>& right() const;
+  const std::optional<std::string>& alias() const;
+
+  // returns the alias if there is one, the name of the input column, or a description such as "(a * b) + c"
+  std::string column_name(const Table& table) const;
+
+  // returns the type string (e.g., "float") of the values this expression produces for the given input table
+  std::string data_type(const Table& table) const;
+
+  // Returns a string that identifies the expression including its alias, see AbstractOperator::fingerprint
+  std::string fingerprint() const;
+
+  // Computes the expression for a chunk of the input, whose columns are defined by the given table. Column expressions
+  // return the input column itself, all other expressions return a new ValueColumn.
+  std::shared_ptr<BaseColumn> evaluate(const Table& table, const Chunk& chunk) const;
+
+ protected:
+  ProjectionExpression(const ExpressionType type, const ColumnID column_id, const AllTypeVariant& value,
+                       const std::shared_ptr<ProjectionExpression>& left,
+                       const std::shared_ptr<ProjectionExpression>& right, const std::optional<std::string>& alias);
+
+  std::string _description(const Table& table) const;
+
+  const ExpressionType _type;
+  const ColumnID _column_id;
+  const AllTypeVariant _value;
+  const std::shared_ptr<ProjectionExpression> _left;
+  const std::shared_ptr<ProjectionExpression> _right;
+  const std::optional<std::string> _alias;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "result_cache.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "type_cast.hpp"
+
+namespace opossum {
+
+ResultCache& ResultCache::get() {
+  static ResultCache instance;
+  return instance;
+}
+
+void ResultCache::set_capacity(const size_t capacity) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _capacity = capacity;
+  _evict_to_capacity();
+}
+
+size_t ResultCache::capacity() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _capacity;
+}
+
+size_t ResultCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.size();
+}
+
+std::shared_ptr<const Table> ResultCache::try_get(const std::string& fingerprint) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_capacity == 0) return nullptr;
+
+  const auto entry = _entry_by_fingerprint.find(fingerprint);
+  if (entry == _entry_by_fingerprint.end()) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  ++_hit_count;
+  _entries.splice(_entries.begin(), _entries, entry->second);
+  return entry->second->second;
+}
+
+void ResultCache::set(const std::string& fingerprint, const std::shared_ptr<const Table>& output) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_capacity == 0) return;
+
+  const auto entry = _entry_by_fingerprint.find(fingerprint);
+  if (entry != _entry_by_fingerprint.end()) {
+    entry->second->second = output;
+    _entries.splice(_entries.begin(), _entries, entry->second);
+    return;
+  }
+
+  _entries.emplace_front(fingerprint, output);
+  _entry_by_fingerprint.emplace(fingerprint, _entries.begin());
+  _evict_to_capacity();
+}
+
+void ResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _entry_by_fingerprint.clear();
+}
+
+uint64_t ResultCache::hit_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _hit_count;
+}
+
+uint64_t ResultCache::miss_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _miss_count;
+}
+
+void ResultCache::reset() {
+  auto& cache = get();
+  std::lock_guard<std::mutex> lock(cache._mutex);
+  cache._capacity = 0;
+  cache._entries.clear();
+  cache._entry_by_fingerprint.clear();
+  cache._hit_count = 0;
+  cache._miss_count = 0;
+}
+
+void ResultCache::_evict_to_capacity() {
+  while (_entries.size() > _capacity) {
+    _entry_by_fingerprint.erase(_entries.back().first);
+    _entries.pop_back();
+  }
+}
+
+std::string fingerprint_string(const std::string& string) { return std::to_string(string.size()) + ":" + string; }
+
+std::string fingerprint_value(const AllTypeVariant& value) {
+  // which() tells the type, so that, e.g., the int 1 and the string "1" differ
+  return std::to_string(value.which()) + ":" + fingerprint_string(type_cast<std::string>(value));
+}
+
+}  // namespace opossum
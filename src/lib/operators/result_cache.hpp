@@ -0,0 +1,69 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Caches the outputs of operators by their fingerprint (see AbstractOperator::fingerprint), so that plans that are
+// executed over and over again, e.g., by dashboards, reuse the previous output as long as the tables they read have
+// not changed. AbstractOperator::execute looks up the cache before executing an operator and stores the output
+// afterwards. Outputs are immutable, so a cached output can be handed to any number of consumers.
+//
+// The cache is disabled until a capacity (the number of cached outputs) is set. When it is full, the least recently
+// used output is evicted. All methods are thread-safe.
+class ResultCache : private Noncopyable {
+ public:
+  static ResultCache& get();
+
+  // sets the number of outputs the cache holds, evicting outputs if necessary. 0 disables the cache.
+  void set_capacity(const size_t capacity);
+  size_t capacity() const;
+
+  // returns the number of cached outputs
+  size_t size() const;
+
+  // returns the cached output or nullptr
+  std::shared_ptr<const Table> try_get(const std::string& fingerprint);
+
+  void set(const std::string& fingerprint, const std::shared_ptr<const Table>& output);
+
+  void clear();
+
+  uint64_t hit_count() const;
+  uint64_t miss_count() const;
+
+  // removes all outputs, disables the cache, and resets the counters, used especially in tests
+  static void reset();
+
+ protected:
+  ResultCache() = default;
+
+  void _evict_to_capacity();
+
+  mutable std::mutex _mutex;
+  size_t _capacity = 0;
+
+  // the most recently used output comes first
+  std::list<std::pair<std::string, std::shared_ptr<const Table>>> _entries;
+  std::unordered_map<std::string, decltype(_entries)::iterator> _entry_by_fingerprint;
+
+  uint64_t _hit_count = 0;
+  uint64_t _miss_count = 0;
+};
+
+// Encode parameters for fingerprints such that different values never result in the same string, e.g., by prefixing
+// strings with their length
+std::string fingerprint_string(const std::string& string);
+std::string fingerprint_value(const AllTypeVariant& value);
+
+}  // namespace opossum
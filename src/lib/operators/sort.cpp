@@ -0,0 +1,228 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_jobs.hpp"
+#include "storage/materialize.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+class BaseSortColumn {
+ public:
+  virtual ~BaseSortColumn() = default;
+
+  // makes the values of the given chunk accessible. Different chunks may be materialized concurrently.
+  virtual void materialize_chunk(const ChunkID chunk_id) = 0;
+
+  // returns a negative value if lhs is sorted before rhs, a positive one if it is sorted after rhs, and 0 otherwise
+  virtual int compare(const RowID& lhs, const RowID& rhs) const = 0;
+};
+
+// Holds the values of one sort column. ValueColumns are used in place, all other columns are materialized. The columns
+// are kept until the sort is done, so that the columns of evictable chunks cannot be evicted while they are used.
+template <typename T>
+class SortColumn : public BaseSortColumn {
+ public:
+  SortColumn(const Table& table, const ColumnID column_id, const OrderByMode order_by_mode)
+      : _table(table),
+        _column_id(column_id),
+        _ascending(order_by_mode == OrderByMode::Ascending),
+        _columns(table.chunk_count()),
+        _materialized_values(table.chunk_count()),
+        _values_by_chunk(table.chunk_count()) {}
+
+  void materialize_chunk(const ChunkID chunk_id) override {
+    const auto column = _table.get_shared_chunk(chunk_id)->get_column(_column_id);
+    _columns[chunk_id] = column;
+
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+      _values_by_chunk[chunk_id] = value_column->values();
+      return;
+    }
+
+    _materialized_values[chunk_id] = materialize_values<T>(*column);
+    _values_by_chunk[chunk_id] = _materialized_values[chunk_id];
+  }
+
+  int compare(const RowID& lhs, const RowID& rhs) const override {
+    const auto& lhs_value = value(lhs);
+    const auto& rhs_value = value(rhs);
+
+    if (lhs_value < rhs_value) return _ascending ? -1 : 1;
+    if (rhs_value < lhs_value) return _ascending ? 1 : -1;
+    return 0;
+  }
+
+  const T& value(const RowID& row_id) const { return _values_by_chunk[row_id.chunk_id][row_id.chunk_offset]; }
+
+  bool ascending() const { return _ascending; }
+
+ protected:
+  const Table& _table;
+  const ColumnID _column_id;
+  const bool _ascending;
+  std::vector<std::shared_ptr<const BaseColumn>> _columns;
+  std::vector<std::vector<T>> _materialized_values;
+  std::vector<Span<T>> _values_by_chunk;
+};
+
+// Sorts all rows of the table. The type of the primary sort column is resolved at compile time so that the by far
+// most frequent comparison does not need a virtual call.
+template <typename PrimaryType>
+std::shared_ptr<PosList> sort_rows(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions,
+                                   const std::optional<uint64_t> limit) {
+  const auto& primary_definition = sort_definitions.front();
+  SortColumn<PrimaryType> primary_column(table, primary_definition.column_id, primary_definition.order_by_mode);
+
+  std::vector<std::unique_ptr<BaseSortColumn>> secondary_columns;
+  for (auto definition = sort_definitions.cbegin() + 1; definition != sort_definitions.cend(); ++definition) {
+    secondary_columns.emplace_back(make_unique_by_column_type<BaseSortColumn, SortColumn>(
+        table.column_type(definition->column_id), table, definition->column_id, definition->order_by_mode));
+  }
+
+  const auto primary_ascending = primary_column.ascending();
+  const auto less = [&](const RowID& lhs, const RowID& rhs) {
+    const auto& lhs_value = primary_column.value(lhs);
+    const auto& rhs_value = primary_column.value(rhs);
+    if (lhs_value < rhs_value) return primary_ascending;
+    if (rhs_value < lhs_value) return !primary_ascending;
+
+    for (const auto& secondary_column : secondary_columns) {
+      const auto result = secondary_column->compare(lhs, rhs);
+      if (result != 0) return result < 0;
+    }
+
+    // Rows that are equal in all sort columns keep their input order. This also makes the (unstable) std::sort and
+    // std::partial_sort deterministic.
+    return lhs < rhs;
+  };
+
+  // Sort every chunk on its own
+  std::vector<PosList> runs(table.chunk_count());
+  for_each_chunk_in_parallel(table, ChunkID{0}, table.chunk_count(), [&](const ChunkID chunk_id) {
+    // an empty table's chunk might be missing actual columns
+    const auto chunk_size = table.get_shared_chunk(chunk_id)->size();
+    if (chunk_size == 0) return;
+
+    primary_column.materialize_chunk(chunk_id);
+    for (const auto& secondary_column : secondary_columns) secondary_column->materialize_chunk(chunk_id);
+
+    auto& run = runs[chunk_id];
+    run.reserve(chunk_size);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      run.push_back(RowID{chunk_id, chunk_offset});
+    }
+
+    if (limit && *limit < run.size()) {
+      // std::partial_sort keeps the best `limit` rows in a heap and only sorts these
+      std::partial_sort(run.begin(), run.begin() + *limit, run.end(), less);
+      run.resize(*limit);
+    } else {
+      std::sort(run.begin(), run.end(), less);
+    }
+  });
+
+  // Merge the sorted chunks
+  auto output_size = size_t{0};
+  for (const auto& run : runs) output_size += run.size();
+  if (limit) output_size = std::min(output_size, static_cast<size_t>(*limit));
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(output_size);
+
+  if (runs.size() == 1) {
+    *pos_list = std::move(runs.front());
+    return pos_list;
+  }
+
+  // Each entry points to the next row of a run as (run index, position in run). The queue returns the smallest row.
+  using RunCursor = std::pair<size_t, size_t>;
+  const auto greater = [&](const RunCursor& lhs, const RunCursor& rhs) {
+    return less(runs[rhs.first][rhs.second], runs[lhs.first][lhs.second]);
+  };
+  std::priority_queue<RunCursor, std::vector<RunCursor>, decltype(greater)> cursors(greater);
+
+  for (size_t run_index = 0; run_index < runs.size(); ++run_index) {
+    if (!runs[run_index].empty()) cursors.emplace(run_index, 0);
+  }
+
+  while (pos_list->size() < output_size) {
+    const auto cursor = cursors.top();
+    cursors.pop();
+
+    pos_list->push_back(runs[cursor.first][cursor.second]);
+    if (cursor.second + 1 < runs[cursor.first].size()) cursors.emplace(cursor.first, cursor.second + 1);
+  }
+
+  return pos_list;
+}
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::optional<uint64_t> limit)
+    : AbstractOperator(in), _sort_definitions(sort_definitions), _limit(limit) {
+  DebugAssert(!_sort_definitions.empty(), "Sort needs at least one column to sort by");
+}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const std::optional<uint64_t> limit)
+    : Sort(in, std::vector<SortColumnDefinition>{{column_id, order_by_mode}}, limit) {}
+
+const std::string Sort::name() const { return "Sort"; }
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+std::optional<uint64_t> Sort::limit() const { return _limit; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  for (const auto& definition : _sort_definitions) {
+    Assert(definition.column_id < input_table->col_count(), "Sort column does not exist");
+  }
+
+  // If our consumer only reads the first rows, there is no need to sort more than these
+  auto limit = _limit;
+  const auto row_limit = row_limit_hint();
+  if (row_limit && (!limit || *row_limit < *limit)) limit = row_limit;
+
+  std::shared_ptr<PosList> pos_list;
+  resolve_data_type(input_table->column_type(_sort_definitions.front().column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    pos_list = sort_rows<ColumnDataType>(*input_table, _sort_definitions, limit);
+  });
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  output->emplace_chunk(create_reference_chunk(input_table, pos_list));
+
+  return output;
+}
+
+std::optional<std::string> Sort::_parameter_fingerprint() const {
+  std::string fingerprint;
+  for (const auto& definition : _sort_definitions) {
+    fingerprint += std::to_string(definition.column_id.t) + ":" +
+                   std::to_string(static_cast<int>(definition.order_by_mode)) + ",";
+  }
+  if (_limit) fingerprint += "limit " + std::to_string(*_limit);
+  return fingerprint;
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode;
+};
+
+// Operator to sort a table by one or more columns. The first definition is the primary sort column, rows that are
+// equal in all sort columns keep their input order.
+//
+// Each chunk is sorted on its own, in parallel by jobs on the CurrentScheduler, before the sorted chunks are combined
+// by a multiway merge. If a limit is given, only the first `limit` rows are produced. In that case, chunks are only
+// partially sorted using a heap so that sorting a large table for its top-N rows does not cost a full sort. A row
+// limit hint set by a consumer (e.g., Limit) has the same effect.
+//
+// The output consists of a single chunk of ReferenceColumns, i.e., no values are copied.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::optional<uint64_t> limit = std::nullopt);
+
+  Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+       const OrderByMode order_by_mode = OrderByMode::Ascending, const std::optional<uint64_t> limit = std::nullopt);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::optional<uint64_t> limit() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const std::optional<uint64_t> _limit;
+};
+
+}  // namespace opossum
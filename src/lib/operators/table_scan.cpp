@@ -0,0 +1,155 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "result_cache.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // appends the positions of all matching rows of the chunk to matches, using the given chunk id
+  virtual void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& matches) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value)
+      : _column_id(column_id), _scan_type(scan_type), _search_value(type_cast<T>(search_value)) {}
+
+  void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& matches) const override {
+    const auto column = chunk.get_column(_column_id);
+
+    // The scan type is resolved once per chunk so that the loops below are specialized for the comparison
+    _resolve_comparator([&](const auto& comparator) {
+      if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+        const auto values = value_column->values();
+        for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+          if (comparator(values[chunk_offset], _search_value)) matches.push_back(RowID{chunk_id, chunk_offset});
+        }
+      } else if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+        _scan_reference_column(*reference_column, chunk_id, matches, comparator);
+      } else {
+        for (ChunkOffset chunk_offset = 0; chunk_offset < column->size(); ++chunk_offset) {
+          if (comparator(type_cast<T>((*column)[chunk_offset]), _search_value)) {
+            matches.push_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      }
+    });
+  }
+
+ protected:
+  template <typename Functor>
+  void _resolve_comparator(const Functor& func) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return func(std::equal_to<T>{});
+      case ScanType::OpNotEquals:
+        return func(std::not_equal_to<T>{});
+      case ScanType::OpLessThan:
+        return func(std::less<T>{});
+      case ScanType::OpLessThanEquals:
+        return func(std::less_equal<T>{});
+      case ScanType::OpGreaterThan:
+        return func(std::greater<T>{});
+      case ScanType::OpGreaterThanEquals:
+        return func(std::greater_equal<T>{});
+      default:
+        Fail("Unknown scan type");
+    }
+  }
+
+  template <typename Comparator>
+  void _scan_reference_column(const ReferenceColumn& reference_column, const ChunkID chunk_id, PosList& matches,
+                              const Comparator& comparator) const {
+    const auto& referenced_table = *reference_column.referenced_table();
+    const auto referenced_column_id = reference_column.referenced_column_id();
+
+    // Consecutive positions usually point into the same chunk, so we only look up the column when the chunk changes
+    auto current_chunk_id = INVALID_CHUNK_ID;
+    std::shared_ptr<BaseColumn> current_column;
+    const ValueColumn<T>* current_value_column = nullptr;
+
+    const auto& pos_list = *reference_column.pos_list();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < pos_list.size(); ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      if (row_id.chunk_id != current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        current_column = referenced_table.get_shared_chunk(current_chunk_id)->get_column(referenced_column_id);
+        current_value_column = dynamic_cast<const ValueColumn<T>*>(current_column.get());
+      }
+
+      const auto matches_value =
+          current_value_column
+              ? comparator(current_value_column->values()[row_id.chunk_offset], _search_value)
+              : comparator(type_cast<T>((*current_column)[row_id.chunk_offset]), _search_value);
+      if (matches_value) matches.push_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const T _search_value;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractChunkWiseOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<Table> TableScan::create_output_table(const Table& input_table) const {
+  Assert(_column_id < input_table.col_count(), "Scan column does not exist");
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table.col_count(); ++column_id) {
+    output->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+  return output;
+}
+
+std::shared_ptr<Chunk> TableScan::execute_chunk(const ChunkWiseInput& input) const {
+  const auto impl = make_unique_by_column_type<BaseTableScanImpl, TableScanImpl>(
+      input.definitions.column_type(_column_id), _column_id, _scan_type, _search_value);
+
+  auto matches = std::make_shared<PosList>();
+  impl->scan_chunk(input.chunk, input.chunk_id, *matches);
+  if (matches->empty()) return nullptr;
+
+  return std::make_shared<Chunk>(create_reference_chunk(input, matches));
+}
+
+void TableScan::_on_empty_output(const std::shared_ptr<const Table>& input_table, Table& output) const {
+  // Even without any matches, the output should have columns
+  output.emplace_chunk(create_reference_chunk(input_table, std::make_shared<PosList>()));
+}
+
+std::optional<std::string> TableScan::_parameter_fingerprint() const {
+  return std::to_string(_column_id.t) + "," + std::to_string(static_cast<int>(_scan_type)) + "," +
+         fingerprint_value(_search_value);
+}
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_operator.hpp"
+#include "abstract_chunk_wise_operator.hpp"
 #include "all_type_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -15,7 +15,12 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
-class TableScan : public AbstractOperator {
+// Operator that returns all rows for which `column_id` compares to `search_value` as specified by `scan_type`.
+// The output has one chunk of ReferenceColumns per input chunk with matches, in the order of the input. The chunks are
+// scanned in parallel by jobs on the CurrentScheduler. The scan stops early once it has produced the number of rows
+// announced via row_limit_hint. Scans can be pipelined with other chunk-wise operators, see
+// AbstractChunkWiseOperator.
+class TableScan : public AbstractChunkWiseOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
@@ -26,8 +31,18 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  std::shared_ptr<Table> create_output_table(const Table& input_table) const override;
+  std::shared_ptr<Chunk> execute_chunk(const ChunkWiseInput& input) const override;
+
+  const std::string name() const override;
+
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+  void _on_empty_output(const std::shared_ptr<const Table>& input_table, Table& output) const override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
@@ -1,12 +1,25 @@
 #include "table_wrapper.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "storage/table.hpp"
+
 namespace opossum {
 
 TableWrapper::TableWrapper(const std::shared_ptr<const Table> table) : _table(table) {}
 
+const std::string TableWrapper::name() const { return "TableWrapper"; }
+
 std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+std::optional<std::string> TableWrapper::_parameter_fingerprint() const {
+  // Versions are unique across tables, so they also identify the table
+  return std::to_string(_table->version());
+}
+
+bool TableWrapper::_returns_existing_table() const { return true; }
+
 }  // namespace opossum
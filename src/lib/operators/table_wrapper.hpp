@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -16,8 +17,12 @@ class TableWrapper : public AbstractOperator {
  public:
   explicit TableWrapper(const std::shared_ptr<const Table> table);
 
+  const std::string name() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+  bool _returns_existing_table() const override;
 
   // Table to retrieve
   const std::shared_ptr<const Table> _table;
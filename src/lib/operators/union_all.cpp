@@ -0,0 +1,46 @@
+#include "union_all.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
+                   const std::shared_ptr<const AbstractOperator> right_in)
+    : AbstractOperator(left_in, right_in) {}
+
+const std::string UnionAll::name() const { return "UnionAll"; }
+
+std::shared_ptr<const Table> UnionAll::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  Assert(left_table->col_count() == right_table->col_count(), "Inputs of UnionAll have a different number of columns");
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->col_count(); ++column_id) {
+    Assert(left_table->column_type(column_id) == right_table->column_type(column_id),
+           "Inputs of UnionAll have different column types");
+    output->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  for (const auto& input_table : {left_table, right_table}) {
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      // an empty table's chunk might be missing actual columns
+      if (input_table->get_chunk(chunk_id).col_count() == 0) continue;
+
+      output->emplace_chunk(input_table->get_shared_chunk(chunk_id));
+    }
+  }
+
+  return output;
+}
+
+std::optional<std::string> UnionAll::_parameter_fingerprint() const { return std::string(); }
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that concatenates the rows of two inputs with the same column types. The output consists of the chunks of
+// the left input followed by those of the right input. The chunks are shared with the inputs, so neither values nor
+// columns are copied. Duplicates are kept, see UnionPositions for a union that removes them.
+class UnionAll : public AbstractOperator {
+ public:
+  UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
+           const std::shared_ptr<const AbstractOperator> right_in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include "union_positions.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The table and columns that an input references. The referenced table is nullptr if the input has no rows.
+struct ReferencedColumns {
+  std::shared_ptr<const Table> table;
+  std::vector<ColumnID> column_ids;
+};
+
+// Collects the positions of all rows of a table consisting of ReferenceColumns and checks that all of its columns
+// reference the same table and share their positions
+PosList collect_positions(const Table& table, ReferencedColumns& referenced_columns) {
+  PosList positions;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    std::shared_ptr<const PosList> chunk_positions;
+    for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+      const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+      Assert(column, "UnionPositions only works on ReferenceColumns");
+
+      // The first chunk with rows determines the referenced columns that all other chunks are checked against
+      if (!referenced_columns.table) referenced_columns.table = column->referenced_table();
+      if (referenced_columns.column_ids.size() == column_id.t) {
+        referenced_columns.column_ids.push_back(column->referenced_column_id());
+      }
+      if (!chunk_positions) chunk_positions = column->pos_list();
+
+      Assert(column->referenced_table() == referenced_columns.table &&
+                 column->referenced_column_id() == referenced_columns.column_ids[column_id],
+             "UnionPositions expects all chunks of both inputs to reference the same columns");
+      Assert(column->pos_list() == chunk_positions || *column->pos_list() == *chunk_positions,
+             "UnionPositions expects all columns of a chunk to reference the same rows");
+    }
+
+    positions.insert(positions.end(), chunk_positions->cbegin(), chunk_positions->cend());
+  }
+
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+  return positions;
+}
+
+}  // namespace
+
+UnionPositions::UnionPositions(const std::shared_ptr<const AbstractOperator> left_in,
+                               const std::shared_ptr<const AbstractOperator> right_in)
+    : AbstractOperator(left_in, right_in) {}
+
+const std::string UnionPositions::name() const { return "UnionPositions"; }
+
+std::shared_ptr<const Table> UnionPositions::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  Assert(left_table->col_count() == right_table->col_count(),
+         "Inputs of UnionPositions have a different number of columns");
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->col_count(); ++column_id) {
+    Assert(left_table->column_type(column_id) == right_table->column_type(column_id),
+           "Inputs of UnionPositions have different column types");
+    output->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  ReferencedColumns referenced_columns;
+  const auto left_positions = collect_positions(*left_table, referenced_columns);
+  const auto right_positions = collect_positions(*right_table, referenced_columns);
+
+  // Without rows, there are no referenced columns to take from the inputs
+  if (!referenced_columns.table) {
+    output->emplace_chunk(create_reference_chunk(left_table, std::make_shared<PosList>()));
+    return output;
+  }
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(std::max(left_positions.size(), right_positions.size()));
+  std::set_union(left_positions.cbegin(), left_positions.cend(), right_positions.cbegin(), right_positions.cend(),
+                 std::back_inserter(*pos_list));
+
+  Chunk chunk;
+  for (const auto& referenced_column_id : referenced_columns.column_ids) {
+    chunk.add_column(std::make_shared<ReferenceColumn>(referenced_columns.table, referenced_column_id, pos_list));
+  }
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+std::optional<std::string> UnionPositions::_parameter_fingerprint() const { return std::string(); }
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that unites two results over the same table, e.g., the outputs of two TableScans for `a < 5 OR b = 3`.
+// Both inputs have to consist of ReferenceColumns that reference the same columns of the same table. Instead of
+// comparing values, the positions of both inputs are sorted and merged, so that rows contained in both inputs or
+// multiple times in one input appear only once.
+//
+// The output consists of a single chunk of ReferenceColumns with the rows ordered by their position in the
+// referenced table.
+class UnionPositions : public AbstractOperator {
+ public:
+  UnionPositions(const std::shared_ptr<const AbstractOperator> left_in,
+                 const std::shared_ptr<const AbstractOperator> right_in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::optional<std::string> _parameter_fingerprint() const override;
+};
+
+}  // namespace opossum
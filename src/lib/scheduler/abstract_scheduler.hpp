@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// Interface of the schedulers that execute tasks, see CurrentScheduler for how to use them
+class AbstractScheduler : private Noncopyable {
+ public:
+  virtual ~AbstractScheduler() = default;
+
+  // starts the workers
+  virtual void begin() = 0;
+
+  // waits until all scheduled tasks are done and stops the workers
+  virtual void finish() = 0;
+
+  // queues a task whose predecessors are done. Tasks are scheduled through AbstractTask::schedule, not directly.
+  virtual void schedule(std::shared_ptr<AbstractTask> task) = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "abstract_task.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  DebugAssert(!_is_scheduled && !successor->_is_scheduled, "Dependencies must be set before scheduling");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_scheduled() const { return _is_scheduled; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::set_preferred_node(const NodeID node_id) {
+  DebugAssert(!_is_scheduled, "The preferred node must be set before scheduling");
+  _preferred_node = node_id;
+}
+
+NodeID AbstractTask::preferred_node() const { return _preferred_node; }
+
+void AbstractTask::schedule() {
+  DebugAssert(!_is_scheduled, "Task must not be scheduled twice");
+  _is_scheduled = true;
+  _try_enqueue();
+}
+
+void AbstractTask::join() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done_condition_variable.wait(lock, [&]() { return static_cast<bool>(_is_done); });
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+void AbstractTask::set_done_callback(std::function<void(std::exception_ptr)> done_callback) {
+  DebugAssert(!_is_scheduled, "The done callback must be set before scheduling");
+  _done_callback = std::move(done_callback);
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task must not be executed before its predecessors are done");
+  DebugAssert(!_is_done, "Task must not be executed twice");
+
+  std::exception_ptr exception;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    exception = _exception;
+  }
+
+  if (!exception) {
+    try {
+      _on_execute();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+  }
+
+  for (const auto& successor : _successors) {
+    if (exception) {
+      std::lock_guard<std::mutex> lock(successor->_mutex);
+      if (!successor->_exception) successor->_exception = exception;
+    }
+    --successor->_pending_predecessor_count;
+    successor->_try_enqueue();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _exception = exception;
+    _is_done = true;
+  }
+  _done_condition_variable.notify_all();
+
+  if (_done_callback) {
+    // Released after the call so that the task does not keep the captured objects alive
+    const auto done_callback = std::move(_done_callback);
+    _done_callback = nullptr;
+    done_callback(exception);
+  }
+}
+
+void AbstractTask::_try_enqueue() {
+  // Both schedule() and the last predecessor call this, but only one of them may queue the task
+  if (!_is_scheduled || !is_ready() || _is_enqueued.exchange(true)) return;
+
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->schedule(shared_from_this());
+  } else {
+    execute();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractTask is the super class of everything that can be executed by the scheduler. Tasks can depend on other
+// tasks (their predecessors) and are only executed once all predecessors are done.
+//
+// Lifecycle:
+// 1. The task is created and its dependencies are declared using set_as_predecessor_of.
+// 2. schedule() hands the task to the CurrentScheduler. The task is queued as soon as all predecessors are done. If
+// there is no scheduler, the task is executed right away (or by its last predecessor) on the calling thread.
+// 3. A worker executes the task. Afterwards, successors that are now ready are queued and everybody waiting in join()
+// is woken up.
+//
+// Tasks shall not be scheduled twice.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
+ public:
+  virtual ~AbstractTask() = default;
+
+  // declares that `successor` may only be executed after this task is done. Must be called before scheduling.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // returns whether all predecessors are done
+  bool is_ready() const;
+
+  bool is_scheduled() const;
+  bool is_done() const;
+
+  // NUMA node (as an index into the scheduler's Topology) whose workers should execute the task, e.g., because it
+  // processes a chunk stored there. Must be set before scheduling. Other workers may still steal the task.
+  void set_preferred_node(const NodeID node_id);
+  NodeID preferred_node() const;
+
+  // hands the task to the CurrentScheduler, see above
+  void schedule();
+
+  // Blocks until the task is done and rethrows its exception, if any. Use CurrentScheduler::wait_for_tasks to wait
+  // from within another task.
+  void join();
+
+  // Sets a function that is called by the executing thread once the task is done, with the task's exception or nullptr.
+  // This allows to react to a task's completion without blocking a thread in join(). Must be set before scheduling.
+  void set_done_callback(std::function<void(std::exception_ptr)> done_callback);
+
+  // Executes the task. Called by the worker that pulled the task from a queue. If the task throws, the exception is
+  // passed on to all successors, which are not executed, and rethrown by join().
+  void execute();
+
+ protected:
+  virtual void _on_execute() = 0;
+
+  // queues the task if it is scheduled and ready. Guarantees that the task is only queued once.
+  void _try_enqueue();
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  NodeID _preferred_node = INVALID_NODE_ID;
+  std::atomic_uint _pending_predecessor_count{0};
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+  std::atomic_bool _is_done{false};
+
+  // guards _exception, which is also set by failed predecessors
+  std::mutex _mutex;
+  std::condition_variable _done_condition_variable;
+  std::exception_ptr _exception;
+
+  std::function<void(std::exception_ptr)> _done_callback;
+};
+
+}  // namespace opossum
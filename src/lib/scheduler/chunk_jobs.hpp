@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/cpu_time.hpp"
+
+namespace opossum {
+
+// Calls func(chunk_id) for every chunk id of the table in [begin, end), each as a JobTask on the CurrentScheduler, and
+// waits until all of them are done. Chunk-wise operators use this to process their input on all cores. Jobs prefer
+// the workers of the NUMA node that their chunk was placed on. The jobs run concurrently, so func must only write to
+// state that belongs to its chunk, e.g., a slot in a vector with one entry per chunk. Without a scheduler, the chunks
+// are processed one after another on the calling thread.
+template <typename Functor>
+void for_each_chunk_in_parallel(const Table& table, const ChunkID begin, const ChunkID end, const Functor& func) {
+  if (end <= begin) return;
+
+  if (end - begin == 1 || !CurrentScheduler::is_set()) {
+    for (auto chunk_id = begin; chunk_id < end; ++chunk_id) func(chunk_id);
+    return;
+  }
+
+  // The CPU time of the jobs is added to the operator that is executed on this thread, see OperatorPerformanceData
+  const auto job_cpu_time = JobCpuTime::current();
+
+  std::vector<std::shared_ptr<JobTask>> jobs;
+  jobs.reserve(end - begin);
+  for (auto chunk_id = begin; chunk_id < end; ++chunk_id) {
+    auto job = std::make_shared<JobTask>([&func, chunk_id, job_cpu_time]() {
+      const auto cpu_time_begin = thread_cpu_time();
+      func(chunk_id);
+      if (job_cpu_time) job_cpu_time->add(std::this_thread::get_id(), thread_cpu_time() - cpu_time_begin);
+    });
+    job->set_preferred_node(table.get_chunk(chunk_id).node_id());
+    jobs.push_back(std::move(job));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+// Calls func(index) for every index in [0, count), each as a JobTask on the CurrentScheduler, and waits until all of
+// them are done. Like for_each_chunk_in_parallel, but for work that does not belong to a chunk of a table, e.g., parts
+// of a file that is loaded.
+template <typename Functor>
+void for_each_in_parallel(const size_t count, const Functor& func) {
+  if (count <= 1 || !CurrentScheduler::is_set()) {
+    for (size_t index = 0; index < count; ++index) func(index);
+    return;
+  }
+
+  const auto job_cpu_time = JobCpuTime::current();
+
+  std::vector<std::shared_ptr<JobTask>> jobs;
+  jobs.reserve(count);
+  for (size_t index = 0; index < count; ++index) {
+    jobs.push_back(std::make_shared<JobTask>([&func, index, job_cpu_time]() {
+      const auto cpu_time_begin = thread_cpu_time();
+      func(index);
+      if (job_cpu_time) job_cpu_time->add(std::this_thread::get_id(), thread_cpu_time() - cpu_time_begin);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+// Number of chunks that operators hand to for_each_chunk_in_parallel at once if they might stop early, e.g., because
+// of a row limit hint. One chunk per core keeps all cores busy without processing many chunks that are not needed.
+inline ChunkID::base_type chunk_job_batch_size() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+}  // namespace opossum
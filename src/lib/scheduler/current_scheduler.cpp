@@ -0,0 +1,21 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+
+namespace opossum {
+
+const std::shared_ptr<AbstractScheduler>& CurrentScheduler::get() { return _instance(); }
+
+void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
+  _instance() = instance;
+  if (instance) instance->begin();
+}
+
+bool CurrentScheduler::is_set() { return static_cast<bool>(_instance()); }
+
+std::shared_ptr<AbstractScheduler>& CurrentScheduler::_instance() {
+  static std::shared_ptr<AbstractScheduler> instance;
+  return instance;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+// Holds the scheduler that tasks are handed to. As long as no scheduler is set, tasks are executed on the thread that
+// schedules them, which is also what most tests rely on.
+//
+// Example:
+//   CurrentScheduler::set(std::make_shared<WorkStealingScheduler>());
+//   CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(operator));
+//   CurrentScheduler::get()->finish();
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<AbstractScheduler>& get();
+
+  // sets and begins the given scheduler. The previous one has to be finished by the caller.
+  static void set(const std::shared_ptr<AbstractScheduler>& instance);
+
+  static bool is_set();
+
+  template <typename TaskType>
+  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+    for (const auto& task : tasks) task->schedule();
+  }
+
+  // Waits until all tasks are done and rethrows the first exception of a task. When called from within a task, the
+  // worker executes other tasks in the meantime so that waiting tasks cannot block all workers.
+  template <typename TaskType>
+  static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+    if (const auto worker = Worker::get_this_thread_worker()) {
+      worker->process_tasks_until([&]() {
+        for (const auto& task : tasks) {
+          if (!task->is_done()) return false;
+        }
+        return true;
+      });
+    }
+
+    for (const auto& task : tasks) task->join();
+  }
+
+  template <typename TaskType>
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+    schedule_tasks(tasks);
+    wait_for_tasks(tasks);
+  }
+
+ protected:
+  static std::shared_ptr<AbstractScheduler>& _instance();
+};
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// Task that executes an arbitrary function, e.g., to process a single chunk within an operator
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(std::function<void()> function) : _function(std::move(function)) {}
+
+ protected:
+  void _on_execute() override { _function(); }
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_chunk_wise_operator.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+using ConsumerCounts = std::unordered_map<std::shared_ptr<const AbstractOperator>, size_t>;
+
+// Counts for every operator that has not been executed yet by how many operators it is read
+void count_consumers(const std::shared_ptr<const AbstractOperator>& op, ConsumerCounts& consumer_counts) {
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input || input->get_output()) continue;
+
+    // Inputs are only visited for their first consumer
+    if (consumer_counts[input]++ == 0) count_consumers(input, consumer_counts);
+  }
+}
+
+// A chunk-wise operator that is read by a single chunk-wise operator is executed as part of its consumer's pipeline
+bool is_pipelined_into_consumer(const std::shared_ptr<const AbstractOperator>& op,
+                                const std::shared_ptr<const AbstractOperator>& consumer,
+                                const ConsumerCounts& consumer_counts) {
+  return std::dynamic_pointer_cast<const AbstractChunkWiseOperator>(op) &&
+         std::dynamic_pointer_cast<const AbstractChunkWiseOperator>(consumer) && consumer->input_left() == op &&
+         consumer_counts.at(op) == 1;
+}
+
+std::shared_ptr<OperatorTask> add_operator_tasks(
+    const std::shared_ptr<const AbstractOperator>& op, const ConsumerCounts& consumer_counts,
+    std::unordered_map<std::shared_ptr<const AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_operator,
+    std::vector<std::shared_ptr<OperatorTask>>& tasks);
+
+// An operator whose output is in the ResultCache takes it right away, so neither it nor its inputs need to be executed
+bool is_cached(const std::shared_ptr<const AbstractOperator>& op) {
+  return std::const_pointer_cast<AbstractOperator>(op)->try_use_cached_output();
+}
+
+// Makes the tasks of the operators that `op` reads from predecessors of `task`. Operators that are pipelined into
+// `op` get no task of their own, their inputs are read by `task` instead.
+void add_input_tasks(
+    const std::shared_ptr<const AbstractOperator>& op, const std::shared_ptr<OperatorTask>& task,
+    const ConsumerCounts& consumer_counts,
+    std::unordered_map<std::shared_ptr<const AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_operator,
+    std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input || input->get_output() || is_cached(input)) continue;
+
+    if (is_pipelined_into_consumer(input, op, consumer_counts)) {
+      add_input_tasks(input, task, consumer_counts, task_by_operator, tasks);
+    } else {
+      add_operator_tasks(input, consumer_counts, task_by_operator, tasks)->set_as_predecessor_of(task);
+    }
+  }
+}
+
+// Returns the task of the given operator, creating it and the tasks of its inputs if necessary
+std::shared_ptr<OperatorTask> add_operator_tasks(
+    const std::shared_ptr<const AbstractOperator>& op, const ConsumerCounts& consumer_counts,
+    std::unordered_map<std::shared_ptr<const AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_operator,
+    std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  const auto existing_task = task_by_operator.find(op);
+  if (existing_task != task_by_operator.end()) return existing_task->second;
+
+  // Inputs are only referenced as const, but executing them is what the consumer expects to happen
+  auto task = std::make_shared<OperatorTask>(std::const_pointer_cast<AbstractOperator>(op));
+  add_input_tasks(op, task, consumer_counts, task_by_operator, tasks);
+
+  task_by_operator.emplace(op, task);
+  tasks.push_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator(op) {}
+
+std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  std::vector<std::shared_ptr<OperatorTask>> tasks;
+  if (op->get_output() || is_cached(op)) return tasks;
+
+  ConsumerCounts consumer_counts;
+  count_consumers(op, consumer_counts);
+
+  std::unordered_map<std::shared_ptr<const AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_operator;
+  add_operator_tasks(op, consumer_counts, task_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _operator; }
+
+void OperatorTask::_on_execute() { _operator->execute(); }
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Task that executes an operator. The tasks of an operator's inputs are its predecessors.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates tasks for the given operator and all operators it (transitively) reads from, with the dependencies
+  // between them already set. Operators that are used as input by more than one operator get a single task, already
+  // executed operators get none. A chunk-wise operator that is only read by another chunk-wise operator gets no task
+  // either, as it is executed as part of its consumer's pipeline (see AbstractChunkWiseOperator). Operators whose
+  // output is found in the ResultCache take it right away and get no tasks for themselves or their inputs. Inputs come
+  // before their consumers, so the task of `op` is the last one.
+  static std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
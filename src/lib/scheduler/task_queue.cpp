@@ -0,0 +1,45 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace opossum {
+
+void TaskQueue::push(std::shared_ptr<AbstractTask> task) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.push_back(std::move(task));
+  }
+  _new_task.notify_one();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.front());
+  _tasks.pop_front();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.back());
+  _tasks.pop_back();
+  return task;
+}
+
+bool TaskQueue::empty() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _tasks.empty();
+}
+
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _new_task.wait_for(lock, timeout, [&]() { return !_tasks.empty(); });
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// Queue of tasks that are ready to be executed. Its worker takes tasks from the front, other workers steal from the
+// back so that they interfere as little as possible with the owner.
+class TaskQueue : private Noncopyable {
+ public:
+  void push(std::shared_ptr<AbstractTask> task);
+
+  // returns nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+  // blocks until a task is pushed or the timeout is reached
+  void wait_for_task(const std::chrono::microseconds timeout);
+
+ protected:
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  mutable std::mutex _mutex;
+  std::condition_variable _new_task;
+};
+
+}  // namespace opossum
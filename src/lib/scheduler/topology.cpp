@@ -0,0 +1,85 @@
+#include "topology.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if OPOSSUM_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Topology::Topology(std::vector<TopologyNode> nodes, const bool is_fake) : _nodes(std::move(nodes)), _is_fake(is_fake) {
+  Assert(!_nodes.empty(), "A topology needs at least one node");
+}
+
+std::shared_ptr<Topology> Topology::create_numa_topology(const std::optional<uint32_t> max_worker_count) {
+  auto remaining_cpu_count = max_worker_count.value_or(std::numeric_limits<uint32_t>::max());
+
+#if OPOSSUM_NUMA_SUPPORT
+  if (numa_available() >= 0) {
+    std::vector<TopologyNode> nodes;
+    auto cpu_mask = numa_allocate_cpumask();
+
+    for (auto numa_node_id = 0; numa_node_id <= numa_max_node() && remaining_cpu_count > 0; ++numa_node_id) {
+      if (numa_node_to_cpus(numa_node_id, cpu_mask) != 0) continue;
+
+      TopologyNode node{NodeID{static_cast<NodeID::base_type>(numa_node_id)}, {}};
+      for (auto cpu_id = 0u; cpu_id < cpu_mask->size && remaining_cpu_count > 0; ++cpu_id) {
+        if (!numa_bitmask_isbitset(cpu_mask, cpu_id)) continue;
+        node.cpu_ids.push_back(cpu_id);
+        --remaining_cpu_count;
+      }
+
+      // Nodes without CPUs only provide memory and get no workers
+      if (!node.cpu_ids.empty()) nodes.push_back(std::move(node));
+    }
+
+    numa_free_cpumask(cpu_mask);
+    if (!nodes.empty()) return std::shared_ptr<Topology>(new Topology(std::move(nodes), false));
+  }
+#endif
+
+  const auto cpu_count = std::min(std::max(1u, std::thread::hardware_concurrency()), remaining_cpu_count);
+  TopologyNode node{INVALID_NODE_ID, {}};
+  for (auto cpu_id = 0u; cpu_id < cpu_count; ++cpu_id) node.cpu_ids.push_back(cpu_id);
+
+  // Without libnuma, we do not know which CPUs exist, so the workers are not pinned
+  return std::shared_ptr<Topology>(new Topology({std::move(node)}, true));
+}
+
+std::shared_ptr<Topology> Topology::create_fake_numa_topology(const uint32_t node_count,
+                                                              const uint32_t workers_per_node) {
+  Assert(workers_per_node > 0, "Every node needs at least one worker");
+
+  std::vector<TopologyNode> nodes;
+  auto cpu_id = 0u;
+  for (auto node_index = 0u; node_index < node_count; ++node_index) {
+    TopologyNode node{INVALID_NODE_ID, {}};
+    for (auto worker_index = 0u; worker_index < workers_per_node; ++worker_index) node.cpu_ids.push_back(cpu_id++);
+    nodes.push_back(std::move(node));
+  }
+
+  return std::shared_ptr<Topology>(new Topology(std::move(nodes), true));
+}
+
+const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
+
+size_t Topology::node_count() const { return _nodes.size(); }
+
+size_t Topology::cpu_count() const {
+  auto cpu_count = size_t{0};
+  for (const auto& node : _nodes) cpu_count += node.cpu_ids.size();
+  return cpu_count;
+}
+
+bool Topology::is_fake() const { return _is_fake; }
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct TopologyNode {
+  // NUMA node number as used by the operating system, INVALID_NODE_ID for nodes of a fake topology
+  NodeID numa_node_id;
+
+  // CPUs that workers of this node run on. For a fake topology, these are only used to count the workers.
+  std::vector<uint32_t> cpu_ids;
+};
+
+// Describes the NUMA nodes of the machine and their CPUs. The scheduler starts one worker per CPU, memory is placed on
+// the nodes with place_chunks_on_nodes. NodeIDs used throughout the code base are indices into nodes().
+class Topology : private Noncopyable {
+ public:
+  // Detects the NUMA nodes using libnuma. Without NUMA support (see OPOSSUM_NUMA_SUPPORT), or if the system does not
+  // support NUMA, this is a single node with all CPUs. If max_worker_count is given, only that many CPUs are used.
+  static std::shared_ptr<Topology> create_numa_topology(const std::optional<uint32_t> max_worker_count = std::nullopt);
+
+  // Creates a topology with the given number of nodes and workers per node, e.g., to test NUMA-aware code on a
+  // single-node machine. Workers of a fake topology are not pinned to CPUs and no memory is moved.
+  static std::shared_ptr<Topology> create_fake_numa_topology(const uint32_t node_count,
+                                                             const uint32_t workers_per_node);
+
+  const std::vector<TopologyNode>& nodes() const;
+  size_t node_count() const;
+  size_t cpu_count() const;
+
+  // returns whether the nodes correspond to actual NUMA nodes
+  bool is_fake() const;
+
+ protected:
+  Topology(std::vector<TopologyNode> nodes, const bool is_fake);
+
+  const std::vector<TopologyNode> _nodes;
+  const bool _is_fake;
+};
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "work_stealing_scheduler.hpp"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+WorkStealingScheduler::WorkStealingScheduler(const std::shared_ptr<Topology>& topology) : _topology(topology) {}
+
+WorkStealingScheduler::WorkStealingScheduler(const uint32_t worker_count)
+    : WorkStealingScheduler(Topology::create_fake_numa_topology(1, worker_count)) {}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+  if (_active) finish();
+}
+
+void WorkStealingScheduler::begin() {
+  DebugAssert(!_active, "Scheduler has already begun");
+
+  _queues.clear();
+  _queues_by_node.assign(_topology->node_count(), {});
+  _workers.clear();
+  for (NodeID node_id{0}; node_id < _topology->node_count(); ++node_id) {
+    for (const auto& cpu_id : _topology->nodes()[node_id].cpu_ids) {
+      const auto worker_id = static_cast<uint32_t>(_workers.size());
+      const auto pinned_cpu_id = _topology->is_fake() ? std::nullopt : std::optional<uint32_t>{cpu_id};
+
+      _queues.emplace_back(std::make_shared<TaskQueue>());
+      _queues_by_node[node_id].push_back(_queues.back());
+      _workers.emplace_back(std::make_shared<Worker>(*this, _queues.back(), worker_id, node_id, pinned_cpu_id));
+    }
+  }
+
+  _active = true;
+  for (const auto& worker : _workers) worker->start();
+}
+
+void WorkStealingScheduler::finish() {
+  // Tasks might still schedule successors, so we wait until nothing is left instead of checking the queues once
+  while (_pending_task_count > 0) std::this_thread::sleep_for(std::chrono::microseconds{100});
+
+  _active = false;
+  for (const auto& worker : _workers) worker->join();
+}
+
+void WorkStealingScheduler::schedule(std::shared_ptr<AbstractTask> task) {
+  DebugAssert(_active, "Tasks can only be scheduled while the scheduler is active");
+  DebugAssert(task->is_ready(), "Only ready tasks are queued");
+
+  ++_pending_task_count;
+
+  const auto worker = Worker::get_this_thread_worker();
+  const auto is_own_worker = worker && &worker->scheduler() == this;
+  const auto preferred_node = task->preferred_node();
+
+  if (preferred_node != INVALID_NODE_ID && preferred_node.t < _queues_by_node.size()) {
+    if (is_own_worker && worker->node_id() == preferred_node) {
+      worker->queue()->push(std::move(task));
+    } else {
+      const auto& node_queues = _queues_by_node[preferred_node];
+      node_queues[_next_queue++ % node_queues.size()]->push(std::move(task));
+    }
+  } else if (is_own_worker) {
+    worker->queue()->push(std::move(task));
+  } else {
+    _queues[_next_queue++ % _queues.size()]->push(std::move(task));
+  }
+}
+
+bool WorkStealingScheduler::is_active() const { return _active; }
+
+const std::shared_ptr<Topology>& WorkStealingScheduler::topology() const { return _topology; }
+
+const std::vector<std::shared_ptr<TaskQueue>>& WorkStealingScheduler::queues() const { return _queues; }
+
+const std::vector<std::shared_ptr<Worker>>& WorkStealingScheduler::workers() const { return _workers; }
+
+void WorkStealingScheduler::task_done() { --_pending_task_count; }
+
+}  // namespace opossum
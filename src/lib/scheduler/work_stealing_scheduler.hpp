@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+
+namespace opossum {
+
+class TaskQueue;
+class Topology;
+class Worker;
+
+// Scheduler with one worker thread and task queue per CPU of the given Topology. Tasks with a preferred node are put
+// into the queue of a worker of that node. Other tasks scheduled from within a task are put into the queue of the
+// current worker, so that, e.g., the jobs of one operator stay close together. All remaining tasks are distributed
+// round-robin. Workers that run out of tasks steal from the other queues, preferring those of their own node.
+class WorkStealingScheduler : public AbstractScheduler {
+ public:
+  // creates a scheduler with one worker per CPU of the topology, which are pinned to these CPUs for actual NUMA nodes
+  explicit WorkStealingScheduler(const std::shared_ptr<Topology>& topology);
+
+  // creates a scheduler with the given number of (unpinned) workers on a single node
+  explicit WorkStealingScheduler(const uint32_t worker_count = std::max(1u, std::thread::hardware_concurrency()));
+
+  ~WorkStealingScheduler() override;
+
+  void begin() override;
+  void finish() override;
+  void schedule(std::shared_ptr<AbstractTask> task) override;
+
+  bool is_active() const;
+
+  const std::shared_ptr<Topology>& topology() const;
+
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const;
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+
+  // called by the workers after executing a task
+  void task_done();
+
+ protected:
+  const std::shared_ptr<Topology> _topology;
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::vector<std::shared_ptr<TaskQueue>>> _queues_by_node;
+  std::vector<std::shared_ptr<Worker>> _workers;
+  std::atomic_bool _active{false};
+
+  // number of tasks that have been queued but not executed yet
+  std::atomic<uint64_t> _pending_task_count{0};
+  std::atomic<uint32_t> _next_queue{0};
+};
+
+}  // namespace opossum
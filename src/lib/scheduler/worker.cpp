@@ -0,0 +1,103 @@
+#include "worker.hpp"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "work_stealing_scheduler.hpp"
+
+namespace {
+
+thread_local opossum::Worker* this_thread_worker = nullptr;
+
+// Pushing a task only wakes the worker of the queue, so idle workers check the other queues for tasks to steal after
+// this time
+constexpr auto IDLE_TIMEOUT = std::chrono::microseconds{500};
+
+}  // namespace
+
+namespace opossum {
+
+Worker* Worker::get_this_thread_worker() { return this_thread_worker; }
+
+Worker::Worker(WorkStealingScheduler& scheduler, const std::shared_ptr<TaskQueue>& queue, const uint32_t id,
+               const NodeID node_id, const std::optional<uint32_t> cpu_id)
+    : _scheduler(scheduler), _queue(queue), _id(id), _node_id(node_id), _cpu_id(cpu_id) {}
+
+uint32_t Worker::id() const { return _id; }
+
+NodeID Worker::node_id() const { return _node_id; }
+
+const std::shared_ptr<TaskQueue>& Worker::queue() const { return _queue; }
+
+const WorkStealingScheduler& Worker::scheduler() const { return _scheduler; }
+
+uint64_t Worker::executed_task_count() const { return _executed_task_count; }
+
+uint64_t Worker::stolen_task_count() const { return _stolen_task_count; }
+
+void Worker::start() {
+  // Stealing within the node keeps the data of stolen tasks local. Starting after our own id spreads the idle workers
+  // of a node over its queues.
+  const auto& workers = _scheduler.workers();
+  _steal_order.clear();
+  for (const auto same_node : {true, false}) {
+    for (auto offset = size_t{1}; offset < workers.size(); ++offset) {
+      const auto& worker = workers[(_id + offset) % workers.size()];
+      if ((worker->node_id() == _node_id) == same_node) _steal_order.push_back(worker->queue());
+    }
+  }
+
+  _thread = std::thread(&Worker::_work_loop, this);
+}
+
+void Worker::join() {
+  if (_thread.joinable()) _thread.join();
+}
+
+void Worker::_work_loop() {
+  this_thread_worker = this;
+
+#if defined(__linux__)
+  if (_cpu_id) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(*_cpu_id, &cpu_set);
+    // Pinning is an optimization only, so we keep running unpinned if it fails
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  }
+#endif
+
+  while (_scheduler.is_active()) {
+    if (!_process_task()) _wait_for_task();
+  }
+
+  this_thread_worker = nullptr;
+}
+
+bool Worker::_process_task() {
+  auto task = _queue->pull();
+
+  if (!task) {
+    for (auto queue = _steal_order.cbegin(); queue != _steal_order.cend() && !task; ++queue) task = (*queue)->steal();
+    if (!task) return false;
+    ++_stolen_task_count;
+  }
+
+  task->execute();
+  ++_executed_task_count;
+  _scheduler.task_done();
+  return true;
+}
+
+void Worker::_wait_for_task() { _queue->wait_for_task(IDLE_TIMEOUT); }
+
+}  // namespace opossum
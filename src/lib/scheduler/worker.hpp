@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TaskQueue;
+class WorkStealingScheduler;
+
+// A worker owns a thread that executes the tasks of its queue. If its own queue is empty, it steals tasks from the
+// queues of the other workers of the same scheduler, trying the workers of its own NUMA node first. If it is given a
+// CPU, its thread is pinned to it.
+class Worker : private Noncopyable {
+ public:
+  // returns the worker that runs on the calling thread, nullptr if the thread is no worker thread
+  static Worker* get_this_thread_worker();
+
+  Worker(WorkStealingScheduler& scheduler, const std::shared_ptr<TaskQueue>& queue, const uint32_t id,
+         const NodeID node_id, const std::optional<uint32_t> cpu_id = std::nullopt);
+
+  uint32_t id() const;
+  NodeID node_id() const;
+  const std::shared_ptr<TaskQueue>& queue() const;
+  const WorkStealingScheduler& scheduler() const;
+
+  // number of tasks executed by this worker and how many of these were stolen from other queues
+  uint64_t executed_task_count() const;
+  uint64_t stolen_task_count() const;
+
+  void start();
+  void join();
+
+  // executes tasks until condition() returns true, used to wait for tasks from within a task
+  template <typename Condition>
+  void process_tasks_until(const Condition& condition) {
+    while (!condition()) {
+      if (!_process_task()) _wait_for_task();
+    }
+  }
+
+ protected:
+  void _work_loop();
+
+  // executes a task from the own queue or, if there is none, one stolen from another queue. Returns false if there
+  // was no task to execute.
+  bool _process_task();
+
+  void _wait_for_task();
+
+  WorkStealingScheduler& _scheduler;
+  const std::shared_ptr<TaskQueue> _queue;
+  const uint32_t _id;
+  const NodeID _node_id;
+  const std::optional<uint32_t> _cpu_id;
+  std::thread _thread;
+
+  // the queues of the other workers in the order in which we try to steal from them
+  std::vector<std::shared_ptr<TaskQueue>> _steal_order;
+  std::atomic<uint64_t> _executed_task_count{0};
+  std::atomic<uint64_t> _stolen_task_count{0};
+};
+
+}  // namespace opossum
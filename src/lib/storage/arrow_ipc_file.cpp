@@ -0,0 +1,478 @@
+#include "arrow_ipc_file.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/mapped_file.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/span.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr char arrow_file_magic[] = {'A', 'R', 'R', 'O', 'W', '1'};
+constexpr uint32_t arrow_continuation_marker = 0xFFFFFFFF;
+
+// Values of the unions and enums in Arrow's Schema.fbs and Message.fbs that we support
+constexpr uint8_t arrow_header_schema = 1;
+constexpr uint8_t arrow_header_dictionary_batch = 2;
+constexpr uint8_t arrow_header_record_batch = 3;
+
+constexpr uint8_t arrow_type_int = 2;
+constexpr uint8_t arrow_type_floating_point = 3;
+constexpr uint8_t arrow_type_utf8 = 5;
+constexpr uint8_t arrow_type_large_utf8 = 20;
+
+constexpr int16_t arrow_precision_single = 1;
+constexpr int16_t arrow_precision_double = 2;
+
+template <typename T>
+T load(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+// A table of a FlatBuffer, in which Arrow stores the metadata of its messages. A table starts with the (signed)
+// distance to its vtable, which holds the size of the vtable, the size of the table, and the position of each field
+// within the table, or 0 for fields that are not set. All accesses are checked against the bounds of the buffer.
+class FlatBufferTable {
+ public:
+  // returns the root table of the buffer, which starts with the offset of the root table
+  static FlatBufferTable root(const char* buffer_begin, const char* buffer_end) {
+    Assert(buffer_end - buffer_begin >= static_cast<ptrdiff_t>(sizeof(uint32_t)), "Arrow file is corrupt");
+    return FlatBufferTable{buffer_begin, buffer_end, buffer_begin + load<uint32_t>(buffer_begin)};
+  }
+
+  FlatBufferTable(const char* buffer_begin, const char* buffer_end, const char* table)
+      : _buffer_begin(buffer_begin), _buffer_end(buffer_end), _table(table) {
+    _check_range(_table, sizeof(int32_t));
+    _vtable = _table - load<int32_t>(_table);
+    _check_range(_vtable, sizeof(uint16_t));
+    _vtable_size = load<uint16_t>(_vtable);
+    _check_range(_vtable, _vtable_size);
+  }
+
+  bool has(const size_t field_index) const { return _field(field_index) != nullptr; }
+
+  template <typename T>
+  T scalar(const size_t field_index, const T default_value) const {
+    const auto field = _field(field_index);
+    if (!field) return default_value;
+    _check_range(field, sizeof(T));
+    return load<T>(field);
+  }
+
+  FlatBufferTable table(const size_t field_index) const {
+    return FlatBufferTable{_buffer_begin, _buffer_end, _target(field_index)};
+  }
+
+  std::string string(const size_t field_index) const {
+    if (!has(field_index)) return "";
+    const auto data = _target(field_index);
+    const auto size = load<uint32_t>(data);
+    _check_range(data + sizeof(uint32_t), size);
+    return std::string(data + sizeof(uint32_t), size);
+  }
+
+  // returns the number of elements of a vector, 0 if it is not set
+  size_t vector_size(const size_t field_index) const {
+    if (!has(field_index)) return 0;
+    return load<uint32_t>(_target(field_index));
+  }
+
+  // returns an element of a vector of tables
+  FlatBufferTable vector_table(const size_t field_index, const size_t index) const {
+    const auto element = _vector_element(field_index, index, sizeof(uint32_t));
+    return FlatBufferTable{_buffer_begin, _buffer_end, element + load<uint32_t>(element)};
+  }
+
+  // returns an element of a vector of structs, which are stored in place
+  const char* vector_struct(const size_t field_index, const size_t index, const size_t struct_size) const {
+    return _vector_element(field_index, index, struct_size);
+  }
+
+ protected:
+  void _check_range(const char* position, const size_t size) const {
+    if (position < _buffer_begin || _buffer_end - position < static_cast<ptrdiff_t>(size)) {
+      Fail("Arrow file is corrupt");
+    }
+  }
+
+  const char* _field(const size_t field_index) const {
+    const auto vtable_entry = 2 * sizeof(uint16_t) + field_index * sizeof(uint16_t);
+    if (vtable_entry + sizeof(uint16_t) > _vtable_size) return nullptr;
+    const auto field_offset = load<uint16_t>(_vtable + vtable_entry);
+    return field_offset == 0 ? nullptr : _table + field_offset;
+  }
+
+  // follows the offset in the field to the table, string, or vector it points to
+  const char* _target(const size_t field_index) const {
+    const auto field = _field(field_index);
+    Assert(field, "Arrow file is missing a required field");
+    _check_range(field, sizeof(uint32_t));
+    const auto target = field + load<uint32_t>(field);
+    _check_range(target, sizeof(uint32_t));
+    return target;
+  }
+
+  const char* _vector_element(const size_t field_index, const size_t index, const size_t element_size) const {
+    Assert(index < vector_size(field_index), "Arrow file is corrupt");
+    const auto element = _target(field_index) + sizeof(uint32_t) + index * element_size;
+    _check_range(element, element_size);
+    return element;
+  }
+
+  const char* _buffer_begin;
+  const char* _buffer_end;
+  const char* _table;
+  const char* _vtable;
+  uint16_t _vtable_size;
+};
+
+struct ArrowType {
+  uint8_t type_id;
+  int32_t bit_width;
+  bool is_signed;
+  int16_t precision;
+};
+
+ArrowType read_type(const uint8_t type_id, const FlatBufferTable& type) {
+  switch (type_id) {
+    case arrow_type_int:
+      return {type_id, type.scalar<int32_t>(0, 0), type.scalar<uint8_t>(1, 0) != 0, 0};
+    case arrow_type_floating_point:
+      return {type_id, 0, true, type.scalar<int16_t>(0, 0)};
+    case arrow_type_utf8:
+    case arrow_type_large_utf8:
+      return {type_id, 0, false, 0};
+    default:
+      Fail("Arrow type " + std::to_string(type_id) + " is not supported");
+  }
+  return {};
+}
+
+// returns the column type of the table that the Arrow type is mapped onto
+std::string column_type_of(const ArrowType& type) {
+  switch (type.type_id) {
+    case arrow_type_int:
+      if (type.is_signed ? type.bit_width <= 32 : type.bit_width <= 16) return "int";
+      if (type.is_signed ? type.bit_width == 64 : type.bit_width == 32) return "long";
+      break;
+    case arrow_type_floating_point:
+      if (type.precision == arrow_precision_single) return "float";
+      if (type.precision == arrow_precision_double) return "double";
+      break;
+    case arrow_type_utf8:
+    case arrow_type_large_utf8:
+      return "string";
+  }
+  Fail("Arrow type is not supported");
+  return "";
+}
+
+// Calls func with a value of the C++ type of the Arrow integer type
+template <typename Functor>
+void resolve_integer_type(const ArrowType& type, const Functor& func) {
+  Assert(type.type_id == arrow_type_int, "Arrow type must be an integer");
+  switch (type.bit_width) {
+    case 8:
+      return type.is_signed ? func(int8_t{}) : func(uint8_t{});
+    case 16:
+      return type.is_signed ? func(int16_t{}) : func(uint16_t{});
+    case 32:
+      return type.is_signed ? func(int32_t{}) : func(uint32_t{});
+    case 64:
+      return type.is_signed ? func(int64_t{}) : func(uint64_t{});
+  }
+  Fail("Arrow integer width is not supported");
+}
+
+struct ArrowField {
+  std::string name;
+  ArrowType type;
+  std::string column_type;
+  // only set for dictionary-encoded fields
+  bool is_dictionary_encoded;
+  int64_t dictionary_id;
+  ArrowType index_type;
+};
+
+// A dictionary as it is used by DictionaryColumns, along with the value id of each index into the Arrow dictionary
+struct ArrowDictionary {
+  std::shared_ptr<void> sorted_values;
+  std::vector<ValueID> value_ids;
+};
+
+// Reads the columns of a record batch one after another. Each column consumes a field node (its length and null
+// count) and a fixed number of buffers, which are located in the body of the message.
+class RecordBatchReader {
+ public:
+  RecordBatchReader(const FlatBufferTable& record_batch, const char* body, const size_t body_size,
+                    const std::shared_ptr<const MappedFile>& file)
+      : _record_batch(record_batch), _body(body), _body_size(body_size), _file(file) {
+    Assert(!_record_batch.has(3), "Compressed Arrow bodies are not supported");
+  }
+
+  size_t length() const { return static_cast<size_t>(_record_batch.scalar<int64_t>(0, 0)); }
+
+  // returns the length of the next column
+  size_t next_node() {
+    const auto node = _record_batch.vector_struct(1, _node_index++, 2 * sizeof(int64_t));
+    Assert(load<int64_t>(node + sizeof(int64_t)) == 0, "Arrow columns with null values are not supported");
+    return static_cast<size_t>(load<int64_t>(node));
+  }
+
+  // returns the next buffer, which is empty if it is not used, e.g., a validity bitmap without null values
+  Span<char> next_buffer() {
+    const auto buffer = _record_batch.vector_struct(2, _buffer_index++, 2 * sizeof(int64_t));
+    const auto offset = static_cast<uint64_t>(load<int64_t>(buffer));
+    const auto size = static_cast<uint64_t>(load<int64_t>(buffer + sizeof(int64_t)));
+    Assert(offset <= _body_size && size <= _body_size - offset, "Arrow file is corrupt");
+    return Span<char>{_body + offset, size};
+  }
+
+  // Reads a column of numbers. Values are read from the mapped file in place if their type is the one of the column.
+  template <typename T, typename SourceType>
+  std::shared_ptr<BaseColumn> read_numbers() {
+    const auto length = next_node();
+    next_buffer();
+    const auto values = next_buffer();
+    Assert(length <= values.size() / sizeof(SourceType), "Arrow file is corrupt");
+
+    if constexpr (std::is_same_v<T, SourceType>) {
+      if (reinterpret_cast<uintptr_t>(values.data()) % alignof(T) == 0) {
+        return std::make_shared<ValueColumn<T>>(Span<T>{reinterpret_cast<const T*>(values.data()), length}, _file);
+      }
+    }
+
+    std::vector<T> column_values(length);
+    for (size_t index = 0; index < length; ++index) {
+      column_values[index] = static_cast<T>(load<SourceType>(values.data() + index * sizeof(SourceType)));
+    }
+    return std::make_shared<ValueColumn<T>>(std::move(column_values));
+  }
+
+  template <typename OffsetType>
+  std::vector<std::string> read_strings() {
+    const auto length = next_node();
+    next_buffer();
+    const auto offsets = next_buffer();
+    const auto characters = next_buffer();
+    // Writers may leave the offsets of an empty array empty instead of writing a single zero
+    Assert(length == 0 || length < offsets.size() / sizeof(OffsetType), "Arrow file is corrupt");
+
+    std::vector<std::string> strings;
+    strings.reserve(length);
+    for (size_t index = 0; index < length; ++index) {
+      const auto begin = static_cast<size_t>(load<OffsetType>(offsets.data() + index * sizeof(OffsetType)));
+      const auto end = static_cast<size_t>(load<OffsetType>(offsets.data() + (index + 1) * sizeof(OffsetType)));
+      Assert(begin <= end && end <= characters.size(), "Arrow file is corrupt");
+      strings.emplace_back(characters.data() + begin, end - begin);
+    }
+    return strings;
+  }
+
+  // reads a column that is not dictionary-encoded
+  template <typename T>
+  std::shared_ptr<BaseColumn> read_column(const ArrowType& type) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto strings = type.type_id == arrow_type_large_utf8 ? read_strings<int64_t>() : read_strings<int32_t>();
+      return std::make_shared<ValueColumn<std::string>>(std::move(strings));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return type.precision == arrow_precision_single ? read_numbers<T, float>() : read_numbers<T, double>();
+    } else {
+      std::shared_ptr<BaseColumn> column;
+      resolve_integer_type(type, [&](auto source_value) { column = read_numbers<T, decltype(source_value)>(); });
+      return column;
+    }
+  }
+
+  // reads the indices of a dictionary-encoded column as the value ids of a DictionaryColumn
+  template <typename T>
+  std::shared_ptr<BaseColumn> read_dictionary_column(const ArrowField& field, const ArrowDictionary& dictionary) {
+    const auto length = next_node();
+    next_buffer();
+    const auto indices = next_buffer();
+    const auto sorted_values = std::static_pointer_cast<std::vector<T>>(dictionary.sorted_values);
+
+    std::shared_ptr<BaseAttributeVector> attribute_vector;
+    resolve_integer_type(field.index_type, [&](auto index_value) {
+      using IndexType = decltype(index_value);
+      Assert(length <= indices.size() / sizeof(IndexType), "Arrow file is corrupt");
+      attribute_vector = make_fitted_attribute_vector(sorted_values->size(), length);
+      for (size_t chunk_offset = 0; chunk_offset < length; ++chunk_offset) {
+        const auto index = static_cast<uint64_t>(load<IndexType>(indices.data() + chunk_offset * sizeof(IndexType)));
+        if (index >= dictionary.value_ids.size()) Fail("Arrow dictionary index is out of range");
+        attribute_vector->set(chunk_offset, dictionary.value_ids[index]);
+      }
+    });
+    return std::make_shared<DictionaryColumn<T>>(sorted_values, attribute_vector);
+  }
+
+ protected:
+  const FlatBufferTable _record_batch;
+  const char* const _body;
+  const size_t _body_size;
+  const std::shared_ptr<const MappedFile> _file;
+  size_t _node_index = 0;
+  size_t _buffer_index = 0;
+};
+
+std::vector<ArrowField> read_schema(const FlatBufferTable& schema) {
+  Assert(schema.scalar<int16_t>(0, 0) == 0, "Arrow files must be little-endian");
+
+  std::vector<ArrowField> fields;
+  for (size_t field_index = 0; field_index < schema.vector_size(1); ++field_index) {
+    const auto field_table = schema.vector_table(1, field_index);
+    Assert(field_table.vector_size(5) == 0, "Nested Arrow types are not supported");
+
+    ArrowField field{};
+    field.name = field_table.string(0);
+    field.type = read_type(field_table.scalar<uint8_t>(2, 0), field_table.table(3));
+    field.column_type = column_type_of(field.type);
+
+    if (field_table.has(4)) {
+      const auto encoding = field_table.table(4);
+      field.is_dictionary_encoded = true;
+      field.dictionary_id = encoding.scalar<int64_t>(0, 0);
+      // Arrow uses int32 indices by default
+      field.index_type =
+          encoding.has(1) ? read_type(arrow_type_int, encoding.table(1)) : ArrowType{arrow_type_int, 32, true, 0};
+    }
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+// Reads the values of a dictionary batch, sorts them, and determines the value id of each index
+ArrowDictionary read_dictionary(const ArrowField& field, RecordBatchReader& batch) {
+  ArrowDictionary dictionary;
+  resolve_data_type(field.column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto column = batch.read_column<ColumnDataType>(field.type);
+    const auto values = std::static_pointer_cast<ValueColumn<ColumnDataType>>(column)->values();
+
+    auto sorted_values = std::make_shared<std::vector<ColumnDataType>>(values.begin(), values.end());
+    std::sort(sorted_values->begin(), sorted_values->end());
+    sorted_values->erase(std::unique(sorted_values->begin(), sorted_values->end()), sorted_values->end());
+
+    dictionary.value_ids.reserve(values.size());
+    for (const auto& value : values) {
+      const auto position = std::lower_bound(sorted_values->cbegin(), sorted_values->cend(), value);
+      dictionary.value_ids.emplace_back(static_cast<ValueID::base_type>(position - sorted_values->cbegin()));
+    }
+    dictionary.sorted_values = std::move(sorted_values);
+  });
+  return dictionary;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> read_arrow_ipc_file(const std::string& file_name) {
+  const auto file = std::make_shared<const MappedFile>(file_name);
+  const auto data = file->data();
+  auto position = size_t{0};
+  auto end = file->size();
+
+  // The file format surrounds a stream with magic bytes and adds a footer that we do not need
+  if (end >= sizeof(arrow_file_magic) && std::equal(data, data + sizeof(arrow_file_magic), arrow_file_magic)) {
+    const auto trailer_size = sizeof(int32_t) + sizeof(arrow_file_magic);
+    Assert(end >= 8 + trailer_size, "Arrow file is truncated");
+    const auto footer_size = static_cast<size_t>(load<int32_t>(data + end - trailer_size));
+    Assert(footer_size <= end - 8 - trailer_size, "Arrow file is corrupt");
+    position = 8;
+    end -= trailer_size + footer_size;
+  }
+
+  std::vector<ArrowField> fields;
+  std::map<int64_t, ArrowDictionary> dictionaries;
+  std::vector<Chunk> chunks;
+  auto has_schema = false;
+
+  while (end - position >= sizeof(uint32_t)) {
+    // Messages start with a continuation marker, except in files written before Arrow 0.15
+    auto metadata_size = static_cast<size_t>(load<uint32_t>(data + position));
+    position += sizeof(uint32_t);
+    if (metadata_size == arrow_continuation_marker) {
+      Assert(end - position >= sizeof(uint32_t), "Arrow file is truncated");
+      metadata_size = load<uint32_t>(data + position);
+      position += sizeof(uint32_t);
+    }
+    // A message without metadata marks the end of the stream
+    if (metadata_size == 0) break;
+
+    Assert(metadata_size <= end - position, "Arrow file is truncated");
+    const auto message = FlatBufferTable::root(data + position, data + position + metadata_size);
+    position += metadata_size;
+
+    const auto body_size = static_cast<size_t>(message.scalar<int64_t>(3, 0));
+    Assert(body_size <= end - position, "Arrow file is truncated");
+    const auto body = data + position;
+    position += body_size;
+
+    const auto header_type = message.scalar<uint8_t>(1, 0);
+    if (header_type == arrow_header_schema) {
+      fields = read_schema(message.table(2));
+      has_schema = true;
+    } else if (header_type == arrow_header_dictionary_batch) {
+      Assert(has_schema, "Arrow schema must come first");
+      const auto dictionary_batch = message.table(2);
+      Assert(dictionary_batch.scalar<uint8_t>(2, 0) == 0, "Arrow delta dictionaries are not supported");
+
+      const auto id = dictionary_batch.scalar<int64_t>(0, 0);
+      const auto field = std::find_if(fields.cbegin(), fields.cend(), [&](const ArrowField& candidate) {
+        return candidate.is_dictionary_encoded && candidate.dictionary_id == id;
+      });
+      Assert(field != fields.cend(), "Arrow dictionary is not used by any field");
+
+      RecordBatchReader batch(dictionary_batch.table(1), body, body_size, file);
+      dictionaries[id] = read_dictionary(*field, batch);
+    } else if (header_type == arrow_header_record_batch) {
+      Assert(has_schema, "Arrow schema must come first");
+      RecordBatchReader batch(message.table(2), body, body_size, file);
+
+      Chunk chunk;
+      for (const auto& field : fields) {
+        resolve_data_type(field.column_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          if (field.is_dictionary_encoded) {
+            const auto dictionary = dictionaries.find(field.dictionary_id);
+            Assert(dictionary != dictionaries.cend(), "Arrow dictionary must come before its record batches");
+            chunk.add_column(batch.read_dictionary_column<ColumnDataType>(field, dictionary->second));
+          } else {
+            chunk.add_column(batch.read_column<ColumnDataType>(field.type));
+          }
+        });
+      }
+      Assert(chunk.size() == batch.length(), "Arrow columns must have the length of their record batch");
+      chunks.push_back(std::move(chunk));
+    }
+  }
+  Assert(has_schema, "Arrow file has no schema");
+
+  auto max_chunk_size = uint32_t{0};
+  for (const auto& chunk : chunks) max_chunk_size = std::max(max_chunk_size, chunk.size());
+
+  auto table = std::make_shared<Table>(max_chunk_size);
+  for (const auto& field : fields) table->add_column_definition(field.name, field.column_type);
+  for (auto& chunk : chunks) table->emplace_chunk(std::move(chunk));
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+// Reads a file in the Arrow IPC format, either in the file format (starting with "ARROW1") or in the stream format,
+// as written by, e.g., pyarrow.ipc.new_file or new_stream. Each record batch becomes a chunk of the table, whose
+// maximum chunk size is the length of the longest batch.
+//
+// The Arrow types are mapped onto the column types of the table: signed integers up to 32 bit and unsigned integers up
+// to 16 bit become int, int64 and uint32 become long, float32 and float64 become float and double, and Utf8 and
+// LargeUtf8 become string. Dictionary-encoded columns become DictionaryColumns without decoding their values: the
+// dictionary is sorted once, and the indices are only translated into the sorted value ids. Columns of int32, int64,
+// float32, and float64 read their values from the mapped file (see MappedFile) instead of copying them. Other types,
+// nested types, null values, delta dictionaries, and compressed bodies are not supported.
+std::shared_ptr<Table> read_arrow_ipc_file(const std::string& file_name);
+
+}  // namespace opossum
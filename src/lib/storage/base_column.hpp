@@ -28,5 +28,9 @@ class BaseColumn : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // Returns an estimate of the number of bytes the column occupies. Memory that strings allocate for their characters
+  // is not included.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
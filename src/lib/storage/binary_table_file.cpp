@@ -0,0 +1,397 @@
+#include "binary_table_file.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/mapped_file.hpp"
+#include "storage/materialize.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/span.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr char binary_table_magic[] = {'O', 'P', 'B', 'T'};
+constexpr uint32_t binary_table_format_version = 2;
+
+// Arrays start at multiples of this, so that they can be used in place when the file is mapped into memory
+constexpr size_t binary_array_alignment = 8;
+
+enum class BinaryColumnEncoding : uint8_t { Values = 0, Dictionary = 1 };
+
+// Writes to a stream and keeps track of the position relative to where it started, so that a chunk is written the
+// same way no matter where it is placed
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(std::ostream& out) : _out(out) {}
+
+  void write_bytes(const char* data, const size_t size) {
+    _out.write(data, size);
+    _position += size;
+  }
+
+  template <typename T>
+  void write_value(const T& value) {
+    write_bytes(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void write_string(const std::string& value) {
+    write_value(static_cast<uint32_t>(value.size()));
+    write_bytes(value.data(), value.size());
+  }
+
+  template <typename T>
+  void write_array(const Span<T> values) {
+    align();
+    write_bytes(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+  }
+
+  void align() {
+    static const char padding[binary_array_alignment] = {};
+    const auto remainder = _position % binary_array_alignment;
+    if (remainder != 0) write_bytes(padding, binary_array_alignment - remainder);
+  }
+
+ protected:
+  std::ostream& _out;
+  size_t _position = 0;
+};
+
+// Reads from a stream, the counterpart of BinaryWriter
+class StreamReader {
+ public:
+  static constexpr auto maps_arrays = false;
+
+  explicit StreamReader(std::istream& in) : _in(in) {}
+
+  void read_bytes(char* data, const size_t size) {
+    _in.read(data, size);
+    _position += size;
+  }
+
+  template <typename T>
+  std::vector<T> read_array(const size_t count) {
+    align();
+    std::vector<T> values(count);
+    read_bytes(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+    return values;
+  }
+
+  void align() {
+    const auto remainder = _position % binary_array_alignment;
+    if (remainder == 0) return;
+    _in.ignore(binary_array_alignment - remainder);
+    _position += binary_array_alignment - remainder;
+  }
+
+ protected:
+  std::istream& _in;
+  size_t _position = 0;
+};
+
+// Reads from a memory-mapped file. Arrays of numbers are not copied, but used where they are in the file.
+class MappedReader {
+ public:
+  static constexpr auto maps_arrays = true;
+
+  explicit MappedReader(std::shared_ptr<const MappedFile> file) : _file(std::move(file)) {}
+
+  void read_bytes(char* data, const size_t size) {
+    std::memcpy(data, _consume(size), size);
+  }
+
+  template <typename T>
+  std::vector<T> read_array(const size_t count) {
+    const auto values = map_array<T>(count);
+    return std::vector<T>(values.begin(), values.end());
+  }
+
+  template <typename T>
+  Span<T> map_array(const size_t count) {
+    align();
+    return Span<T>{reinterpret_cast<const T*>(_consume(count * sizeof(T))), count};
+  }
+
+  void align() {
+    const auto remainder = _position % binary_array_alignment;
+    if (remainder != 0) _consume(binary_array_alignment - remainder);
+  }
+
+  const std::shared_ptr<const MappedFile>& file() const { return _file; }
+
+ protected:
+  const char* _consume(const size_t size) {
+    Assert(_position + size <= _file->size(), "Binary table file is truncated");
+    const auto data = _file->data() + _position;
+    _position += size;
+    return data;
+  }
+
+  const std::shared_ptr<const MappedFile> _file;
+  size_t _position = 0;
+};
+
+template <typename T, typename Reader>
+T read_value(Reader& reader) {
+  auto value = T{};
+  reader.read_bytes(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+template <typename Reader>
+std::string read_string(Reader& reader) {
+  std::string value(read_value<uint32_t>(reader), '\0');
+  reader.read_bytes(value.data(), value.size());
+  return value;
+}
+
+// Numbers are written as one array. Strings are written as an array of their lengths followed by their characters.
+template <typename T>
+void write_values(BinaryWriter& writer, const Span<T> values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::vector<uint32_t> lengths;
+    lengths.reserve(values.size());
+    for (const auto& value : values) lengths.push_back(static_cast<uint32_t>(value.size()));
+    writer.write_array(Span<uint32_t>{lengths});
+    for (const auto& value : values) writer.write_bytes(value.data(), value.size());
+  } else {
+    writer.write_array(values);
+  }
+}
+
+template <typename T, typename Reader>
+std::vector<T> read_values(Reader& reader, const size_t count) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto lengths = reader.template read_array<uint32_t>(count);
+    std::vector<std::string> values;
+    values.reserve(count);
+    for (const auto length : lengths) {
+      values.emplace_back(length, '\0');
+      reader.read_bytes(values.back().data(), length);
+    }
+    return values;
+  } else {
+    return reader.template read_array<T>(count);
+  }
+}
+
+template <typename uintX_t>
+void write_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  if (const auto fitted_vector = dynamic_cast<const FittedAttributeVector<uintX_t>*>(&attribute_vector)) {
+    writer.write_array(fitted_vector->value_ids());
+    return;
+  }
+
+  std::vector<uintX_t> value_ids;
+  value_ids.reserve(attribute_vector.size());
+  for (size_t chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+    value_ids.push_back(static_cast<uintX_t>(attribute_vector.get(chunk_offset)));
+  }
+  writer.write_array(Span<uintX_t>{value_ids});
+}
+
+template <typename uintX_t, typename Reader>
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(Reader& reader, const size_t size) {
+  if constexpr (Reader::maps_arrays) {
+    return std::make_shared<FittedAttributeVector<uintX_t>>(reader.template map_array<uintX_t>(size), reader.file());
+  } else {
+    return std::make_shared<FittedAttributeVector<uintX_t>>(reader.template read_array<uintX_t>(size));
+  }
+}
+
+template <typename T>
+void write_column(BinaryWriter& writer, const BaseColumn& column) {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    writer.write_value(BinaryColumnEncoding::Dictionary);
+    writer.write_value(attribute_vector.width());
+    writer.write_value(static_cast<uint32_t>(dictionary_column->unique_values_count()));
+    write_values(writer, Span<T>{*dictionary_column->dictionary()});
+
+    switch (attribute_vector.width()) {
+      case 1:
+        write_attribute_vector<uint8_t>(writer, attribute_vector);
+        break;
+      case 2:
+        write_attribute_vector<uint16_t>(writer, attribute_vector);
+        break;
+      default:
+        write_attribute_vector<uint32_t>(writer, attribute_vector);
+    }
+    return;
+  }
+
+  writer.write_value(BinaryColumnEncoding::Values);
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    write_values(writer, value_column->values());
+  } else {
+    write_values(writer, Span<T>{materialize_values<T>(column)});
+  }
+}
+
+// Dictionaries are always copied, as they are usually small compared to the attribute vector
+template <typename T, typename Reader>
+std::shared_ptr<BaseColumn> read_column(Reader& reader, const size_t row_count) {
+  const auto encoding = read_value<BinaryColumnEncoding>(reader);
+  if (encoding == BinaryColumnEncoding::Values) {
+    if constexpr (Reader::maps_arrays && std::is_arithmetic_v<T>) {
+      return std::make_shared<ValueColumn<T>>(reader.template map_array<T>(row_count), reader.file());
+    } else {
+      return std::make_shared<ValueColumn<T>>(read_values<T>(reader, row_count));
+    }
+  }
+  Assert(encoding == BinaryColumnEncoding::Dictionary, "Binary table file has a column of unknown encoding");
+
+  const auto width = read_value<AttributeVectorWidth>(reader);
+  const auto dictionary_size = read_value<uint32_t>(reader);
+  auto dictionary = std::make_shared<std::vector<T>>(read_values<T>(reader, dictionary_size));
+
+  switch (width) {
+    case 1:
+      return std::make_shared<DictionaryColumn<T>>(dictionary, read_attribute_vector<uint8_t>(reader, row_count));
+    case 2:
+      return std::make_shared<DictionaryColumn<T>>(dictionary, read_attribute_vector<uint16_t>(reader, row_count));
+    case 4:
+      return std::make_shared<DictionaryColumn<T>>(dictionary, read_attribute_vector<uint32_t>(reader, row_count));
+  }
+  Fail("Binary table file has an attribute vector of unknown width");
+  return nullptr;
+}
+
+// Every chunk starts at a multiple of binary_array_alignment, so the positions of the readers and writers are relative
+// to the start of the chunk
+template <typename Reader>
+Chunk read_chunk(const std::vector<std::string>& column_types, Reader& reader) {
+  const auto row_count = read_value<uint32_t>(reader);
+
+  Chunk chunk;
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      chunk.add_column(read_column<ColumnDataType>(reader, row_count));
+    });
+  }
+  reader.align();
+  return chunk;
+}
+
+template <typename Reader, typename ChunkReader>
+std::shared_ptr<Table> read_table(Reader& reader, const ChunkReader& read_chunk) {
+  char magic[sizeof(binary_table_magic)] = {};
+  reader.read_bytes(magic, sizeof(magic));
+  Assert(std::memcmp(magic, binary_table_magic, sizeof(magic)) == 0, "Not a binary table file");
+  Assert(read_value<uint32_t>(reader) == binary_table_format_version, "Binary table file has an unsupported version");
+
+  const auto chunk_size = read_value<uint32_t>(reader);
+  const auto chunk_count = read_value<ChunkID::base_type>(reader);
+  const auto column_count = read_value<uint16_t>(reader);
+
+  std::vector<std::string> column_types;
+  for (auto column_id = 0; column_id < column_count; ++column_id) column_types.push_back(read_string(reader));
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (const auto& column_type : column_types) table->add_column_definition(read_string(reader), column_type);
+  reader.align();
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) table->emplace_chunk(read_chunk(column_types));
+  return table;
+}
+
+}  // namespace
+
+void write_binary_table(const Table& table, std::ostream& out) {
+  write_binary_table_header(table, out);
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    write_binary_chunk(table.column_types(), table.get_chunk(chunk_id), out);
+  }
+  Assert(out.good(), "Could not write binary table file");
+}
+
+void write_binary_table_header(const Table& table, std::ostream& out) {
+  BinaryWriter writer(out);
+  writer.write_bytes(binary_table_magic, sizeof(binary_table_magic));
+  writer.write_value(binary_table_format_version);
+  writer.write_value(table.chunk_size());
+  writer.write_value(table.chunk_count().t);
+  writer.write_value(table.col_count());
+  for (const auto& column_type : table.column_types()) writer.write_string(column_type);
+  for (const auto& column_name : table.column_names()) writer.write_string(column_name);
+  writer.align();
+}
+
+std::shared_ptr<Table> read_binary_table(std::istream& in) {
+  StreamReader reader(in);
+  const auto table = read_table(reader, [&](const std::vector<std::string>& column_types) {
+    return read_binary_chunk(column_types, in);
+  });
+  Assert(in.good(), "Binary table file is truncated");
+  return table;
+}
+
+std::shared_ptr<Table> map_binary_table(const std::string& file_name) {
+  const auto file = std::make_shared<const MappedFile>(file_name);
+
+  MappedReader reader(file);
+  return read_table(reader, [&](const std::vector<std::string>& column_types) {
+    return read_chunk(column_types, reader);
+  });
+}
+
+void write_binary_chunk(const std::vector<std::string>& column_types, const Chunk& chunk, std::ostream& out) {
+  BinaryWriter writer(out);
+  writer.write_value(chunk.size());
+
+  for (ColumnID column_id{0}; column_id < column_types.size(); ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // the first chunk of an empty table might be missing actual columns
+      if (chunk.col_count() == 0) {
+        write_column<ColumnDataType>(writer, ValueColumn<ColumnDataType>{});
+      } else {
+        write_column<ColumnDataType>(writer, *chunk.get_column(column_id));
+      }
+    });
+  }
+  writer.align();
+}
+
+Chunk read_binary_chunk(const std::vector<std::string>& column_types, std::istream& in) {
+  StreamReader reader(in);
+  auto chunk = read_chunk(column_types, reader);
+  Assert(in.good(), "Binary table file is truncated");
+  return chunk;
+}
+
+void write_binary_column(const std::string& column_type, const BaseColumn& column, std::ostream& out) {
+  BinaryWriter writer(out);
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    write_column<ColumnDataType>(writer, column);
+  });
+  writer.align();
+}
+
+std::shared_ptr<BaseColumn> read_binary_column(const std::string& column_type, const size_t row_count,
+                                               std::istream& in) {
+  StreamReader reader(in);
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    column = read_column<ColumnDataType>(reader, row_count);
+  });
+  Assert(in.good(), "Binary column is truncated");
+  return column;
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+class Table;
+
+// Binary table files store a table in a compact typed layout, so that it can be loaded without parsing text. All
+// numbers are written in the byte order of the machine:
+//
+//   magic "OPBT", format version (uint32)
+//   max chunk size (uint32), chunk count (uint32), column count (uint16)
+//   column types, then column names, each as length (uint32) followed by its characters
+//   chunks, each with its row count (uint32) followed by the columns:
+//     encoding (uint8), 0 for values, 1 for a dictionary
+//     values: the raw array of the values
+//     dictionary: width of the attribute vector (uint8), dictionary size (uint32), the raw array of the dictionary,
+//                 the raw array of the value ids at the width of the attribute vector
+//
+// Strings are written as an array of their lengths (uint32) followed by their characters. DictionaryColumns stay
+// encoded, all other columns but ValueColumns (e.g., ReferenceColumns) are written as values. Arrays, the chunks, and
+// the end of the file are aligned to 8 bytes by padding, so that a mapped file can be read in place.
+
+// writes the table to the stream
+void write_binary_table(const Table& table, std::ostream& out);
+
+// reads a table that was written by write_binary_table
+std::shared_ptr<Table> read_binary_table(std::istream& in);
+
+// Maps the file into memory (see MappedFile) and creates a table whose ValueColumns of numbers and attribute vectors
+// read from the mapping. Only the metadata, string values, and dictionaries are read right away, so that opening a
+// table is cheap and its data does not need to fit into memory. The file must not be changed while it is mapped.
+std::shared_ptr<Table> map_binary_table(const std::string& file_name);
+
+// Writes everything of the table but its chunks, which are expected to follow, each written by write_binary_chunk
+void write_binary_table_header(const Table& table, std::ostream& out);
+
+// Writes a chunk with the given column types, e.g., so that chunks can be written on their own or concurrently into
+// separate buffers. This is the layout of one chunk in a table file.
+void write_binary_chunk(const std::vector<std::string>& column_types, const Chunk& chunk, std::ostream& out);
+
+// reads a chunk that was written by write_binary_chunk for a table with the given column types
+Chunk read_binary_chunk(const std::vector<std::string>& column_types, std::istream& in);
+
+// Writes a single column of the given type in the layout of a column within a chunk, padded to the alignment, so that
+// columns can be stored and loaded on their own
+void write_binary_column(const std::string& column_type, const BaseColumn& column, std::ostream& out);
+
+// reads a column with the given number of rows that was written by write_binary_column
+std::shared_ptr<BaseColumn> read_binary_column(const std::string& column_type, const size_t row_count,
+                                               std::istream& in);
+
+}  // namespace opossum
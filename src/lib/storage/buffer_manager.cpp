@@ -0,0 +1,250 @@
+#include "buffer_manager.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_column.hpp"
+#include "binary_table_file.hpp"
+#include "chunk.hpp"
+#include "utils/assert.hpp"
+#include "utils/block_compression.hpp"
+
+namespace opossum {
+
+EvictableColumns::EvictableColumns(const std::vector<std::string>& column_types, const Chunk& chunk,
+                                   const std::string& file_name, const BlockCompression compression)
+    : _column_types(column_types),
+      _file_name(file_name),
+      _col_count(chunk.col_count()),
+      _size(chunk.size()),
+      _referenced(std::make_unique<std::atomic_bool[]>(_col_count)) {
+  Assert(_col_count == _column_types.size(), "Evictable chunks need a column of each type");
+
+  std::ofstream file(_file_name, std::ios::binary);
+  Assert(file.is_open(), "Could not create file " + _file_name);
+
+  auto offset = size_t{0};
+  for (ColumnID column_id{0}; column_id < _col_count; ++column_id) {
+    const auto column = chunk.get_column(column_id);
+
+    std::ostringstream buffer;
+    write_binary_column(_column_types[column_id], *column, buffer);
+    const auto serialized_column = buffer.str();
+
+    auto block = std::string();
+    if (compression == BlockCompression::Lz) block = compress_block(serialized_column.data(), serialized_column.size());
+    const auto compressed = !block.empty() && block.size() < serialized_column.size();
+    const auto& stored_column = compressed ? block : serialized_column;
+    file.write(stored_column.data(), stored_column.size());
+
+    _stored_columns.push_back(
+        {offset, stored_column.size(), serialized_column.size(), compressed, column->estimate_memory_usage()});
+    offset += stored_column.size();
+
+    _columns.push_back(column);
+    _referenced[column_id] = true;
+  }
+
+  file.close();
+  Assert(!file.fail(), "Could not write file " + _file_name);
+}
+
+EvictableColumns::~EvictableColumns() {
+  // Every column that is in memory is registered with the BufferManager, whose entries expire now
+  auto resident_count = size_t{0};
+  auto resident_memory_usage = size_t{0};
+  for (ColumnID column_id{0}; column_id < _col_count; ++column_id) {
+    if (!_columns[column_id]) continue;
+    ++resident_count;
+    resident_memory_usage += _stored_columns[column_id].memory_usage;
+  }
+  BufferManager::get().unregister_resident(resident_count, resident_memory_usage);
+
+  std::remove(_file_name.c_str());
+}
+
+std::shared_ptr<BaseColumn> EvictableColumns::get_column(ColumnID column_id) {
+  _referenced[column_id] = true;
+
+  auto loaded = false;
+  std::shared_ptr<BaseColumn> column;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    column = _columns.at(column_id);
+    if (!column) {
+      column = _load_column(column_id);
+      _columns[column_id] = column;
+      loaded = true;
+    }
+  }
+
+  // Outside of the lock, because the BufferManager locks other chunks while evicting their columns
+  if (loaded) BufferManager::get().register_resident(shared_from_this(), column_id, true);
+  return column;
+}
+
+std::shared_ptr<BaseColumn> EvictableColumns::get_column_if_resident(ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _columns.at(column_id);
+}
+
+std::shared_ptr<BaseColumn> EvictableColumns::_load_column(ColumnID column_id) const {
+  const auto& stored_column = _stored_columns[column_id];
+
+  std::ifstream file(_file_name, std::ios::binary);
+  Assert(file.is_open(), "Could not open file " + _file_name);
+  file.seekg(stored_column.offset);
+
+  if (!stored_column.compressed) return read_binary_column(_column_types[column_id], _size, file);
+
+  std::string block(stored_column.stored_size, '\0');
+  file.read(block.data(), block.size());
+  Assert(file.good(), "File " + _file_name + " is truncated");
+
+  std::string serialized_column(stored_column.serialized_size, '\0');
+  decompress_block(block.data(), block.size(), serialized_column.data(), serialized_column.size());
+  std::istringstream buffer(std::move(serialized_column));
+  return read_binary_column(_column_types[column_id], _size, buffer);
+}
+
+uint16_t EvictableColumns::col_count() const { return _col_count; }
+
+uint32_t EvictableColumns::size() const { return _size; }
+
+bool EvictableColumns::is_resident(ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _columns.at(column_id) != nullptr;
+}
+
+size_t EvictableColumns::memory_usage(ColumnID column_id) const { return _stored_columns.at(column_id).memory_usage; }
+
+size_t EvictableColumns::stored_size(ColumnID column_id) const { return _stored_columns.at(column_id).stored_size; }
+
+bool EvictableColumns::try_evict(ColumnID column_id) {
+  // The BufferManager calls this while holding its own lock, so waiting here could deadlock with a thread that is
+  // loading a column and about to register it
+  std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+  if (!lock.owns_lock()) return false;
+
+  auto& column = _columns.at(column_id);
+  if (column.use_count() > 1) return false;
+  column = nullptr;
+  return true;
+}
+
+bool EvictableColumns::test_and_clear_referenced(ColumnID column_id) { return _referenced[column_id].exchange(false); }
+
+BufferManager& BufferManager::get() {
+  static BufferManager instance;
+  return instance;
+}
+
+void BufferManager::set_memory_budget(const size_t memory_budget) {
+  // declared before the lock, so that it is released after the lock (see _evict_to_budget)
+  std::vector<std::shared_ptr<EvictableColumns>> visited_columns;
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = memory_budget;
+  _evict_to_budget(nullptr, ColumnID{0}, visited_columns);
+}
+
+size_t BufferManager::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+size_t BufferManager::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_usage;
+}
+
+void BufferManager::register_resident(const std::shared_ptr<EvictableColumns>& columns, const ColumnID column_id,
+                                      const bool loaded) {
+  std::vector<std::shared_ptr<EvictableColumns>> visited_columns;
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto memory_usage = columns->memory_usage(column_id);
+  _resident_columns.push_back({columns, column_id, memory_usage});
+  _memory_usage += memory_usage;
+  if (loaded) ++_load_count;
+  _evict_to_budget(columns.get(), column_id, visited_columns);
+}
+
+void BufferManager::unregister_resident(const size_t column_count, const size_t memory_usage) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  // Columns that were registered before a reset are not counted anymore
+  _memory_usage -= std::min(memory_usage, _memory_usage);
+  _expired_count = std::min(_expired_count + column_count, _resident_columns.size());
+
+  // The expired entries are removed at once when they make up half of the entries, so that destroying many chunks
+  // does not search the entries for each of them
+  if (_expired_count <= _resident_columns.size() / 2) return;
+  const auto live_end = std::remove_if(_resident_columns.begin(), _resident_columns.end(),
+                                       [](const ResidentColumn& column) { return column.columns.expired(); });
+  _resident_columns.erase(live_end, _resident_columns.end());
+  _expired_count = 0;
+  _clock_hand = 0;
+}
+
+uint64_t BufferManager::load_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _load_count;
+}
+
+uint64_t BufferManager::eviction_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _eviction_count;
+}
+
+void BufferManager::reset() {
+  auto& instance = get();
+  std::lock_guard<std::mutex> lock(instance._mutex);
+  instance._memory_budget = std::numeric_limits<size_t>::max();
+  instance._memory_usage = 0;
+  instance._resident_columns.clear();
+  instance._expired_count = 0;
+  instance._clock_hand = 0;
+  instance._load_count = 0;
+  instance._eviction_count = 0;
+}
+
+void BufferManager::_evict_to_budget(const EvictableColumns* keep_columns, const ColumnID keep_column_id,
+                                     std::vector<std::shared_ptr<EvictableColumns>>& visited_columns) {
+  // Each column is passed at most twice, once to clear its referenced flag and once to evict it
+  auto remaining_steps = 2 * _resident_columns.size();
+  while (_memory_usage > _memory_budget && remaining_steps > 0) {
+    --remaining_steps;
+    if (_clock_hand >= _resident_columns.size()) _clock_hand = 0;
+
+    auto& resident_column = _resident_columns[_clock_hand];
+    const auto columns = resident_column.columns.lock();
+    if (columns) visited_columns.push_back(columns);
+    const auto keep = columns.get() == keep_columns && resident_column.column_id == keep_column_id;
+    // Columns of chunks that no longer exist were unregistered already, their entries are only removed here
+    const auto evicted = !columns || (!keep && !columns->test_and_clear_referenced(resident_column.column_id) &&
+                                      columns->try_evict(resident_column.column_id));
+    if (!evicted) {
+      ++_clock_hand;
+      continue;
+    }
+
+    if (columns) {
+      ++_eviction_count;
+      _memory_usage -= resident_column.memory_usage;
+    } else if (_expired_count > 0) {
+      --_expired_count;
+    }
+
+    // The last entry takes the place of the removed one and is visited next
+    if (&resident_column != &_resident_columns.back()) resident_column = std::move(_resident_columns.back());
+    _resident_columns.pop_back();
+  }
+}
+
+}  // namespace opossum
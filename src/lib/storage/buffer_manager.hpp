@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/block_compression.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+// The columns of an evictable chunk (see Chunk::make_evictable). They are written to a file once and may then be
+// dropped from memory by the BufferManager one by one. get_column reads a column from the file again if it was
+// dropped, without touching the other columns, so that a scan only loads the columns it needs. Each column is stored
+// as a block of its own, which is compressed with compress_block if requested and if that makes it smaller. The file
+// is removed when the columns are destroyed. All methods are thread-safe.
+class EvictableColumns : public std::enable_shared_from_this<EvictableColumns>, private Noncopyable {
+ public:
+  // writes the columns of the chunk to the file, they stay in memory until they are evicted
+  EvictableColumns(const std::vector<std::string>& column_types, const Chunk& chunk, const std::string& file_name,
+                   const BlockCompression compression);
+  ~EvictableColumns();
+
+  // returns the column, loading it if it was evicted
+  std::shared_ptr<BaseColumn> get_column(ColumnID column_id);
+
+  // returns the column if it is in memory and nullptr otherwise, without counting as an access
+  std::shared_ptr<BaseColumn> get_column_if_resident(ColumnID column_id) const;
+
+  uint16_t col_count() const;
+  uint32_t size() const;
+
+  // returns whether the column is in memory
+  bool is_resident(ColumnID column_id) const;
+
+  // returns the estimated memory usage of the column while it is in memory
+  size_t memory_usage(ColumnID column_id) const;
+
+  // returns the number of bytes the column takes in the file, which is less than its serialized size if it was
+  // compressed
+  size_t stored_size(ColumnID column_id) const;
+
+  // Drops the column from memory unless it is used outside of the chunk, i.e., someone holds a pointer returned by
+  // get_column, or columns are being loaded. Returns whether the column was dropped.
+  bool try_evict(ColumnID column_id);
+
+  // returns whether get_column was called for the column since the last call, resetting the flag (see BufferManager)
+  bool test_and_clear_referenced(ColumnID column_id);
+
+ protected:
+  struct StoredColumn {
+    size_t offset;
+    size_t stored_size;
+    size_t serialized_size;
+    bool compressed;
+    size_t memory_usage;
+  };
+
+  std::shared_ptr<BaseColumn> _load_column(ColumnID column_id) const;
+
+  const std::vector<std::string> _column_types;
+  const std::string _file_name;
+  const uint16_t _col_count;
+  const uint32_t _size;
+  std::vector<StoredColumn> _stored_columns;
+
+  // guards _columns, whose entries are nullptr while the columns are evicted
+  mutable std::mutex _mutex;
+  std::vector<std::shared_ptr<BaseColumn>> _columns;
+  std::unique_ptr<std::atomic_bool[]> _referenced;
+};
+
+// Keeps the memory used by the columns of evictable chunks within a budget. Whenever a column is loaded, other columns
+// are evicted until the budget is met again. Columns are chosen by the clock algorithm, which evicts columns that were
+// not accessed since the clock hand passed them last, approximating LRU without a shared list that would need to be
+// updated on every access. Columns in use are skipped, so a single column or columns in use may exceed the budget. All
+// methods are thread-safe.
+class BufferManager : private Noncopyable {
+ public:
+  static BufferManager& get();
+
+  // sets the number of bytes that evictable chunks may use, evicting columns if necessary
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+
+  // returns the estimated memory usage of the evictable chunks that are in memory
+  size_t memory_usage() const;
+
+  // Called for each column of EvictableColumns when they were created, and whenever a column was loaded from their
+  // file. Evicts other columns if the budget is exceeded.
+  void register_resident(const std::shared_ptr<EvictableColumns>& columns, const ColumnID column_id,
+                         const bool loaded);
+
+  // Called when EvictableColumns are destroyed with the number and the memory usage of their columns that were in
+  // memory. Their entries are removed later.
+  void unregister_resident(const size_t column_count, const size_t memory_usage);
+
+  // returns the number of times columns were loaded from or evicted to their file
+  uint64_t load_count() const;
+  uint64_t eviction_count() const;
+
+  // forgets all columns, removes the budget, and resets the counters, used especially in tests
+  static void reset();
+
+ protected:
+  BufferManager() = default;
+
+  // Evicts columns until the budget is met, skipping the column that is given. The EvictableColumns that were looked
+  // at are added to visited_columns, which the caller releases after unlocking _mutex: if they were the last
+  // references, their destructor calls unregister_resident.
+  void _evict_to_budget(const EvictableColumns* keep_columns, const ColumnID keep_column_id,
+                        std::vector<std::shared_ptr<EvictableColumns>>& visited_columns);
+
+  struct ResidentColumn {
+    std::weak_ptr<EvictableColumns> columns;
+    ColumnID column_id;
+    size_t memory_usage;
+  };
+
+  mutable std::mutex _mutex;
+  size_t _memory_budget = std::numeric_limits<size_t>::max();
+  size_t _memory_usage = 0;
+
+  std::vector<ResidentColumn> _resident_columns;
+  // number of entries whose EvictableColumns were destroyed
+  size_t _expired_count = 0;
+  size_t _clock_hand = 0;
+
+  uint64_t _load_count = 0;
+  uint64_t _eviction_count = 0;
+};
+
+}  // namespace opossum
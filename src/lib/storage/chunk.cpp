@@ -1,3 +1,4 @@
+#include <atomic>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -8,27 +9,82 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
 
+#include "resolve_type.hpp"
 #include "utils/assert.hpp"
+#include "value_column.hpp"
 
 namespace opossum {
 
-void Chunk::add_column(std::shared_ptr<BaseColumn> column) { this->_columns.push_back(column); }
+namespace {
+
+std::atomic<uint64_t> storage_version_counter{0};
+
+}  // namespace
+
+uint64_t next_storage_version() { return storage_version_counter++; }
+
+void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
+  Assert(!this->_evictable_columns, "Evictable chunks cannot be modified");
+  this->_columns.push_back(column);
+  this->_version = next_storage_version();
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  Assert(!this->_evictable_columns, "Evictable chunks cannot be modified");
   DebugAssert(values.size() == this->_columns.size(), "append: each column must have exactly one value assigned");
 
   for (unsigned int index = 0; index < this->_columns.size(); ++index) {
     this->_columns[index]->append(values[index]);
   }
+  this->_version = next_storage_version();
+}
+
+std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
+  if (this->_evictable_columns) return this->_evictable_columns->get_column(column_id);
+  return this->_columns.at(column_id);
+}
+
+std::shared_ptr<BaseColumn> Chunk::get_column_if_resident(ColumnID column_id) const {
+  if (this->_evictable_columns) return this->_evictable_columns->get_column_if_resident(column_id);
+  return this->_columns.at(column_id);
+}
+
+void Chunk::make_evictable(const std::vector<std::string>& column_types, const std::string& file_name,
+                           const BlockCompression compression) {
+  Assert(!this->_evictable_columns, "Chunk is evictable already");
+
+  // a table's first chunk may lack its columns while it is empty
+  if (this->_columns.empty()) {
+    for (const auto& column_type : column_types) {
+      this->_columns.push_back(make_shared_by_column_type<BaseColumn, ValueColumn>(column_type));
+    }
+  }
+
+  this->_evictable_columns = std::make_shared<EvictableColumns>(column_types, *this, file_name, compression);
+  this->_columns.clear();
+  for (ColumnID column_id{0}; column_id < column_types.size(); ++column_id) {
+    BufferManager::get().register_resident(this->_evictable_columns, column_id, false);
+  }
 }
 
-std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return this->_columns.at(column_id); }
+bool Chunk::is_evictable() const { return static_cast<bool>(this->_evictable_columns); }
+
+NodeID Chunk::node_id() const { return this->_node_id; }
+
+void Chunk::set_node_id(const NodeID node_id) { this->_node_id = node_id; }
 
-uint16_t Chunk::col_count() const { return this->_columns.size(); }
+uint64_t Chunk::version() const { return this->_version; }
+
+uint16_t Chunk::col_count() const {
+  if (this->_evictable_columns) return this->_evictable_columns->col_count();
+  return this->_columns.size();
+}
 
 uint32_t Chunk::size() const {
+  if (this->_evictable_columns) return this->_evictable_columns->size();
   if (this->_columns.empty()) {
     return 0;
   } else {
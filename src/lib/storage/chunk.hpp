@@ -10,11 +10,17 @@
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
+#include "utils/block_compression.hpp"
 
 namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class EvictableColumns;
+
+// Returns a new version for a table or chunk (see Table::version and Chunk::version). All tables and chunks share this
+// counter, so versions only ever increase and are never assigned twice.
+uint64_t next_storage_version();
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
@@ -42,11 +48,37 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
-  // Returns the column at a given position
+  // Returns the column at a given position. A column of an evictable chunk is loaded from its file if it was evicted,
+  // and it is not evicted while the returned pointer exists.
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // returns the column if it is in memory and nullptr for an evicted column of an evictable chunk, without loading it
+  std::shared_ptr<BaseColumn> get_column_if_resident(ColumnID column_id) const;
+
+  // Writes the columns to the file and hands them to the BufferManager, which drops them from memory when evictable
+  // chunks exceed its memory budget (see EvictableColumns). With BlockCompression::Lz, the columns are compressed in
+  // the file, which trades the time to decompress a column when it is loaded for less I/O. The file is removed
+  // together with the chunk. An evictable chunk cannot be modified anymore.
+  void make_evictable(const std::vector<std::string>& column_types, const std::string& file_name,
+                      const BlockCompression compression = BlockCompression::None);
+  bool is_evictable() const;
+
+  // The NUMA node (as an index into the Topology) that holds the chunk's data, INVALID_NODE_ID if it was not placed.
+  // Chunk-wise operators prefer to process the chunk on workers of that node. See place_chunks_on_nodes.
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+
+  // Returns a number that increases whenever columns or rows are added to the chunk through the methods above. A chunk
+  // that is compressed by its table is replaced by a chunk with a new version. Changes made directly to a column are
+  // not noticed.
+  uint64_t version() const;
+
  protected:
   std::vector<std::shared_ptr<BaseColumn>> _columns;
+  // replaces _columns for evictable chunks
+  std::shared_ptr<EvictableColumns> _evictable_columns;
+  NodeID _node_id = INVALID_NODE_ID;
+  uint64_t _version = next_storage_version();
 };
 
 }  // namespace opossum
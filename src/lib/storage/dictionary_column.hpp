@@ -1,19 +1,24 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
 
 namespace opossum {
 
-class BaseAttributeVector;
-class BaseColumn;
-
 // Even though ValueIDs do not have to use the full width of ValueID (uint32_t), this will also work for smaller ValueID
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
@@ -25,48 +30,93 @@ class DictionaryColumn : public BaseColumn {
   /**
    * Creates a Dictionary column from a given value column.
    */
-  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column);
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column) {
+    std::vector<T> values;
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(base_column)) {
+      const auto column_values = value_column->values();
+      values.assign(column_values.begin(), column_values.end());
+    } else {
+      values.reserve(base_column->size());
+      for (size_t chunk_offset = 0; chunk_offset < base_column->size(); ++chunk_offset) {
+        values.push_back(type_cast<T>((*base_column)[chunk_offset]));
+      }
+    }
+
+    auto dictionary = values;
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+    dictionary.shrink_to_fit();
+
+    _attribute_vector = make_fitted_attribute_vector(dictionary.size(), values.size());
+    for (size_t chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+      const auto value_id = std::lower_bound(dictionary.cbegin(), dictionary.cend(), values[chunk_offset]);
+      _attribute_vector->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(value_id - dictionary.cbegin())});
+    }
+
+    _dictionary = std::make_shared<std::vector<T>>(std::move(dictionary));
+  }
 
-  // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
-  // the DictionaryColumn in this file. Replace the method signatures with actual implementations.
+  /**
+   * Creates a Dictionary column from an already encoded dictionary and attribute vector, e.g., when loading it.
+   */
+  DictionaryColumn(const std::shared_ptr<std::vector<T>>& dictionary,
+                   const std::shared_ptr<BaseAttributeVector>& attribute_vector)
+      : _dictionary(dictionary), _attribute_vector(attribute_vector) {}
 
   // return the value at a certain position. If you want to write efficient operators, back off!
-  const AllTypeVariant operator[](const size_t i) const override;
+  const AllTypeVariant operator[](const size_t i) const override {
+    PerformanceWarning("operator[] used");
+
+    return get(i);
+  }
 
   // return the value at a certain position.
-  const T get(const size_t i) const;
+  const T get(const size_t i) const { return (*_dictionary)[_attribute_vector->get(i)]; }
 
   // dictionary columns are immutable
-  void append(const AllTypeVariant&) override;
+  void append(const AllTypeVariant&) override { throw std::logic_error("DictionaryColumn is immutable"); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const;
+  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
-  ValueID lower_bound(T value) const;
+  ValueID lower_bound(T value) const {
+    const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(it - _dictionary->cbegin())};
+  }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
-  ValueID upper_bound(T value) const;
+  ValueID upper_bound(T value) const {
+    const auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(it - _dictionary->cbegin())};
+  }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const;
+  size_t unique_values_count() const { return _dictionary->size(); }
 
   // return the number of entries
-  size_t size() const override;
+  size_t size() const override { return _attribute_vector->size(); }
+
+  size_t estimate_memory_usage() const override {
+    return sizeof(*this) + sizeof(std::vector<T>) + _dictionary->capacity() * sizeof(T) +
+           _attribute_vector->size() * _attribute_vector->width();
+  }
 
  protected:
   std::shared_ptr<std::vector<T>> _dictionary;
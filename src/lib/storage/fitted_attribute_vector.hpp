@@ -0,0 +1,66 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/span.hpp"
+
+namespace opossum {
+
+// FittedAttributeVector stores value ids in the smallest unsigned integer type that can hold all of them, i.e.,
+// uint8_t, uint16_t, or uint32_t
+template <typename uintX_t>
+class FittedAttributeVector : public BaseAttributeVector {
+ public:
+  explicit FittedAttributeVector(const size_t size) : _value_ids(size) {}
+
+  explicit FittedAttributeVector(std::vector<uintX_t>&& value_ids) : _value_ids(std::move(value_ids)) {}
+
+  // Creates a read-only attribute vector whose value ids are held by someone else, e.g., a memory-mapped file (see
+  // MappedFile), who is kept alive as long as the attribute vector
+  FittedAttributeVector(const Span<uintX_t> value_ids, std::shared_ptr<const void> owner)
+      : _external_value_ids(value_ids), _external_value_ids_owner(std::move(owner)) {}
+
+  ValueID get(const size_t i) const override { return ValueID{value_ids()[i]}; }
+
+  void set(const size_t i, const ValueID value_id) override {
+    DebugAssert(value_id.t <= std::numeric_limits<uintX_t>::max(), "value id does not fit into attribute vector");
+    DebugAssert(!_external_value_ids_owner, "external value ids are read-only");
+    _value_ids[i] = static_cast<uintX_t>(value_id);
+  }
+
+  size_t size() const override { return value_ids().size(); }
+
+  AttributeVectorWidth width() const override { return sizeof(uintX_t); }
+
+  // Returns all value ids. Use this instead of get() in loops to avoid virtual calls.
+  Span<uintX_t> value_ids() const {
+    if (_external_value_ids_owner) return _external_value_ids;
+    return _value_ids;
+  }
+
+ protected:
+  std::vector<uintX_t> _value_ids;
+  Span<uintX_t> _external_value_ids;
+  std::shared_ptr<const void> _external_value_ids_owner;
+};
+
+// Creates an attribute vector of the given size that is just wide enough for the value ids of a dictionary of the
+// given size, i.e., up to dictionary_size - 1
+inline std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(const size_t dictionary_size,
+                                                                         const size_t size) {
+  if (dictionary_size <= size_t{std::numeric_limits<uint8_t>::max()} + 1) {
+    return std::make_shared<FittedAttributeVector<uint8_t>>(size);
+  }
+  if (dictionary_size <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+    return std::make_shared<FittedAttributeVector<uint16_t>>(size);
+  }
+  return std::make_shared<FittedAttributeVector<uint32_t>>(size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "MappedFile: Could not open file " + file_name);
+
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) == -1) {
+    close(file_descriptor);
+    Fail("MappedFile: Could not determine the size of " + file_name);
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // mmap does not accept empty mappings, an empty file is represented by a nullptr
+  if (_size > 0) {
+    const auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    Assert(data != MAP_FAILED, "MappedFile: Could not map file " + file_name);
+    _data = static_cast<const char*>(data);
+  } else {
+    close(file_descriptor);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MappedFile::data() const { return _data; }
+
+size_t MappedFile::size() const { return _size; }
+
+}  // namespace opossum
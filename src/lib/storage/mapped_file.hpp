@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file into memory read-only. Pages are only loaded from the file when they are accessed and can be dropped
+// by the operating system under memory pressure, so the file may be larger than the main memory. Columns that read
+// from the mapping hold a shared_ptr to it (see ValueColumn), which keeps it mapped as long as they exist.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+  ~MappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ protected:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_column.hpp"
+#include "dictionary_column.hpp"
+#include "reference_column.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+// Copies the values of the rows from `begin` to `end` of a column into a typed vector. T has to be the data type of
+// the column. ValueColumns and DictionaryColumns, also when referenced by a ReferenceColumn, are read without going
+// through AllTypeVariant. All other columns fall back to operator[].
+template <typename T>
+std::vector<T> materialize_values(const BaseColumn& base_column, const size_t begin, const size_t end) {
+  DebugAssert(begin <= end && end <= base_column.size(), "Rows to materialize are out of range");
+  std::vector<T> values;
+  values.reserve(end - begin);
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&base_column)) {
+    const auto column_values = value_column->values();
+    values.assign(column_values.begin() + begin, column_values.begin() + end);
+    return values;
+  }
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&base_column)) {
+    const auto& dictionary = *dictionary_column->dictionary();
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      values.push_back(dictionary[attribute_vector.get(chunk_offset)]);
+    }
+    return values;
+  }
+
+  if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&base_column)) {
+    const auto& referenced_table = *reference_column->referenced_table();
+    const auto referenced_column_id = reference_column->referenced_column_id();
+
+    // Consecutive positions usually point into the same chunk, so we only look up the column when the chunk changes
+    auto current_chunk_id = INVALID_CHUNK_ID;
+    std::shared_ptr<BaseColumn> current_column;
+    const ValueColumn<T>* current_value_column = nullptr;
+    const DictionaryColumn<T>* current_dictionary_column = nullptr;
+
+    const auto& pos_list = *reference_column->pos_list();
+    for (auto position = pos_list.cbegin() + begin; position != pos_list.cbegin() + end; ++position) {
+      const auto& row_id = *position;
+      if (row_id.chunk_id != current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        current_column = referenced_table.get_chunk(current_chunk_id).get_column(referenced_column_id);
+        current_value_column = dynamic_cast<const ValueColumn<T>*>(current_column.get());
+        current_dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(current_column.get());
+      }
+
+      if (current_value_column) {
+        values.push_back(current_value_column->values()[row_id.chunk_offset]);
+      } else if (current_dictionary_column) {
+        values.push_back(current_dictionary_column->get(row_id.chunk_offset));
+      } else {
+        values.push_back(type_cast<T>((*current_column)[row_id.chunk_offset]));
+      }
+    }
+    return values;
+  }
+
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    values.push_back(type_cast<T>(base_column[chunk_offset]));
+  }
+  return values;
+}
+
+// copies the values of all rows of a column, see above
+template <typename T>
+std::vector<T> materialize_values(const BaseColumn& base_column) {
+  return materialize_values<T>(base_column, 0, base_column.size());
+}
+
+}  // namespace opossum
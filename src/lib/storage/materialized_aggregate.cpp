@@ -0,0 +1,359 @@
+#include "materialized_aggregate.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Holds the running values of one aggregate for all groups
+class BaseAggregateState {
+ public:
+  virtual ~BaseAggregateState() = default;
+
+  // Adds one row of the column per group id, starting at `begin`. The i-th of these rows belongs to the group
+  // group_ids[i]. Ids of groups that have not been seen before must be the next unused ones.
+  virtual void add(const BaseColumn& column, const ChunkOffset begin, const std::vector<size_t>& group_ids) = 0;
+
+  // returns the type of the result column, e.g., "long" for Count
+  virtual std::string result_type() const = 0;
+
+  // returns a column that holds the aggregates of the given groups in the given order
+  virtual std::shared_ptr<BaseColumn> result_column(const std::vector<size_t>& group_order) const = 0;
+};
+
+// Assigns ids to the groups, i.e., the distinct values of the group-by columns
+class BaseGroupIndex {
+ public:
+  virtual ~BaseGroupIndex() = default;
+
+  // Appends the group id of every row from `begin` to `end` of the chunk to group_ids. Groups that have not been seen
+  // before get the next unused id.
+  virtual void add(const Chunk& chunk, const ChunkOffset begin, const ChunkOffset end,
+                   std::vector<size_t>& group_ids) = 0;
+
+  // returns the ids of all groups, ordered by the values of the groups
+  virtual const std::vector<size_t>& group_order() = 0;
+
+  // adds the group-by columns of the result to the chunk, holding the values of the groups in the given order
+  virtual void add_result_columns(const std::vector<size_t>& group_order, Chunk& chunk) const = 0;
+};
+
+namespace {
+
+// Groups by a single column, whose values are hashed as they are. The order of the groups is kept between refreshes,
+// so that only new groups are sorted.
+template <typename T>
+class GroupIndex : public BaseGroupIndex {
+ public:
+  explicit GroupIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+  void add(const Chunk& chunk, const ChunkOffset begin, const ChunkOffset end,
+           std::vector<size_t>& group_ids) override {
+    for (const auto& value : materialize_values<T>(*chunk.get_column(_column_id), begin, end)) {
+      auto group = _group_ids.find(value);
+      if (group == _group_ids.end()) {
+        group = _group_ids.emplace(value, _values.size()).first;
+        _values.push_back(value);
+      }
+      group_ids.push_back(group->second);
+    }
+  }
+
+  const std::vector<size_t>& group_order() override {
+    const auto sorted_count = _group_order.size();
+    if (sorted_count == _values.size()) return _group_order;
+
+    for (auto group_id = sorted_count; group_id < _values.size(); ++group_id) _group_order.push_back(group_id);
+    const auto by_value = [&](const size_t left, const size_t right) { return _values[left] < _values[right]; };
+    std::sort(_group_order.begin() + sorted_count, _group_order.end(), by_value);
+    std::inplace_merge(_group_order.begin(), _group_order.begin() + sorted_count, _group_order.end(), by_value);
+    return _group_order;
+  }
+
+  void add_result_columns(const std::vector<size_t>& group_order, Chunk& chunk) const override {
+    std::vector<T> values;
+    values.reserve(group_order.size());
+    for (const auto group_id : group_order) values.push_back(_values[group_id]);
+    chunk.add_column(std::make_shared<ValueColumn<T>>(std::move(values)));
+  }
+
+ protected:
+  const ColumnID _column_id;
+  std::unordered_map<T, size_t> _group_ids;
+  // the value of each group, indexed by group id
+  std::vector<T> _values;
+  std::vector<size_t> _group_order;
+};
+
+// Groups by any number of columns, including none, using the values of all group-by columns of a row as the key
+class MultiColumnGroupIndex : public BaseGroupIndex {
+ public:
+  MultiColumnGroupIndex(const Table& table, const std::vector<ColumnID>& column_ids) : _column_ids(column_ids) {
+    for (const auto& column_id : column_ids) _column_types.push_back(table.column_type(column_id));
+  }
+
+  void add(const Chunk& chunk, const ChunkOffset begin, const ChunkOffset end,
+           std::vector<size_t>& group_ids) override {
+    // The columns are read with their types, only the keys consist of AllTypeVariants
+    std::vector<std::vector<AllTypeVariant>> column_values(_column_ids.size());
+    for (size_t index = 0; index < _column_ids.size(); ++index) {
+      resolve_data_type(_column_types[index], [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto values = materialize_values<ColumnDataType>(*chunk.get_column(_column_ids[index]), begin, end);
+        column_values[index].assign(values.cbegin(), values.cend());
+      });
+    }
+
+    std::vector<AllTypeVariant> key(_column_ids.size());
+    for (size_t row = 0; row < end - begin; ++row) {
+      for (size_t index = 0; index < _column_ids.size(); ++index) key[index] = column_values[index][row];
+      auto group = _group_ids.find(key);
+      if (group == _group_ids.end()) group = _group_ids.emplace(key, _group_ids.size()).first;
+      group_ids.push_back(group->second);
+    }
+  }
+
+  const std::vector<size_t>& group_order() override {
+    _group_order.clear();
+    for (const auto& group : _group_ids) _group_order.push_back(group.second);
+    return _group_order;
+  }
+
+  void add_result_columns(const std::vector<size_t>& group_order, Chunk& chunk) const override {
+    // The map holds the groups in the order of group_order
+    for (size_t index = 0; index < _column_ids.size(); ++index) {
+      auto column = make_shared_by_column_type<BaseColumn, ValueColumn>(_column_types[index]);
+      for (const auto& group : _group_ids) column->append(group.first[index]);
+      chunk.add_column(column);
+    }
+  }
+
+ protected:
+  const std::vector<ColumnID> _column_ids;
+  std::vector<std::string> _column_types;
+  // The map orders the groups by their values for the result
+  std::map<std::vector<AllTypeVariant>, size_t> _group_ids;
+  std::vector<size_t> _group_order;
+};
+
+template <typename T>
+class AggregateState : public BaseAggregateState {
+ public:
+  // Integers are summed up as longs so that they do not overflow as quickly
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  AggregateState(const AggregateFunction function, const std::string& column_type)
+      : _function(function), _column_type(column_type) {
+    Assert(std::is_arithmetic_v<T> || (function != AggregateFunction::Sum && function != AggregateFunction::Avg),
+           "Only numbers can be summed up");
+  }
+
+  void add(const BaseColumn& column, const ChunkOffset begin, const std::vector<size_t>& group_ids) override {
+    // only the new rows are read, so that refreshing an aggregate of a growing chunk does not copy all of its rows
+    const auto values = materialize_values<T>(column, begin, begin + group_ids.size());
+
+    for (size_t index = 0; index < group_ids.size(); ++index) {
+      const auto group_id = group_ids[index];
+      const auto& value = values[index];
+
+      if (group_id == _counts.size()) {
+        _counts.push_back(0);
+        _sums.push_back(0);
+        if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _extremes.push_back(value);
+      }
+      DebugAssert(group_id < _counts.size(), "Group ids must be assigned in order");
+
+      ++_counts[group_id];
+      switch (_function) {
+        case AggregateFunction::Count:
+          break;
+        case AggregateFunction::Sum:
+        case AggregateFunction::Avg:
+          if constexpr (std::is_arithmetic_v<T>) _sums[group_id] += value;
+          break;
+        case AggregateFunction::Min:
+          if (value < _extremes[group_id]) _extremes[group_id] = value;
+          break;
+        case AggregateFunction::Max:
+          if (_extremes[group_id] < value) _extremes[group_id] = value;
+          break;
+      }
+    }
+  }
+
+  std::string result_type() const override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        return "long";
+      case AggregateFunction::Sum:
+        return std::is_integral_v<T> ? "long" : "double";
+      case AggregateFunction::Avg:
+        return "double";
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return _column_type;
+    }
+    Fail("Unknown aggregate function");
+    return "";
+  }
+
+  std::shared_ptr<BaseColumn> result_column(const std::vector<size_t>& group_order) const override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        return _create_column<int64_t>(group_order, [&](const size_t group_id) {
+          return static_cast<int64_t>(_counts[group_id]);
+        });
+      case AggregateFunction::Sum:
+        return _create_column<SumType>(group_order, [&](const size_t group_id) { return _sums[group_id]; });
+      case AggregateFunction::Avg:
+        return _create_column<double>(group_order, [&](const size_t group_id) {
+          return static_cast<double>(_sums[group_id]) / _counts[group_id];
+        });
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return _create_column<T>(group_order, [&](const size_t group_id) { return _extremes[group_id]; });
+    }
+    Fail("Unknown aggregate function");
+    return nullptr;
+  }
+
+ protected:
+  template <typename ResultType, typename Functor>
+  static std::shared_ptr<BaseColumn> _create_column(const std::vector<size_t>& group_order,
+                                                    const Functor& result_of_group) {
+    std::vector<ResultType> values;
+    values.reserve(group_order.size());
+    for (const auto group_id : group_order) values.push_back(result_of_group(group_id));
+    return std::make_shared<ValueColumn<ResultType>>(std::move(values));
+  }
+
+  const AggregateFunction _function;
+  const std::string _column_type;
+
+  // indexed by group id, _extremes is only used by Min and Max
+  std::vector<uint64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _extremes;
+};
+
+std::string aggregate_function_name(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "COUNT";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Avg:
+      return "AVG";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+}  // namespace
+
+MaterializedAggregate::MaterializedAggregate(std::shared_ptr<const Table> table,
+                                             const std::vector<ColumnID>& group_by_column_ids,
+                                             const std::vector<AggregateDefinition>& aggregates)
+    : _table(std::move(table)), _group_by_column_ids(group_by_column_ids), _aggregates(aggregates) {
+  for (const auto& column_id : _group_by_column_ids) {
+    Assert(column_id < _table->col_count(), "Group-by column does not exist");
+  }
+
+  if (_group_by_column_ids.size() == 1) {
+    const auto column_id = _group_by_column_ids.front();
+    _group_index = make_unique_by_column_type<BaseGroupIndex, GroupIndex>(_table->column_type(column_id), column_id);
+  } else {
+    _group_index = std::make_unique<MultiColumnGroupIndex>(*_table, _group_by_column_ids);
+  }
+
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column_id < _table->col_count(), "Aggregated column does not exist");
+    const auto& column_type = _table->column_type(aggregate.column_id);
+    _states.emplace_back(make_unique_by_column_type<BaseAggregateState, AggregateState>(column_type, aggregate.function,
+                                                                                         column_type));
+  }
+}
+
+MaterializedAggregate::~MaterializedAggregate() = default;
+
+std::shared_ptr<Table> MaterializedAggregate::refresh() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto row_count = _table->row_count();
+  Assert(row_count >= _aggregated_row_count, "Rows were removed from the aggregated table");
+  if (_result && row_count == _aggregated_row_count) return _result;
+
+  std::vector<size_t> group_ids;
+
+  const auto first_row = _watermark;
+  for (auto chunk_id = first_row.chunk_id; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_shared_chunk(chunk_id);
+    const auto begin = chunk_id == first_row.chunk_id ? first_row.chunk_offset : ChunkOffset{0};
+    const auto end = chunk->size();
+    _watermark = RowID{chunk_id, end};
+    if (begin >= end) continue;
+
+    group_ids.clear();
+    _group_index->add(*chunk, begin, end, group_ids);
+
+    for (size_t index = 0; index < _aggregates.size(); ++index) {
+      _states[index]->add(*chunk->get_column(_aggregates[index].column_id), begin, group_ids);
+    }
+    _aggregated_row_count += end - begin;
+  }
+
+  _result = _build_result();
+  return _result;
+}
+
+std::shared_ptr<Table> MaterializedAggregate::result() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _result;
+}
+
+RowID MaterializedAggregate::watermark() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _watermark;
+}
+
+std::shared_ptr<const Table> MaterializedAggregate::table() const { return _table; }
+
+std::shared_ptr<Table> MaterializedAggregate::_build_result() {
+  auto result = std::make_shared<Table>();
+  Chunk chunk;
+
+  for (const auto& column_id : _group_by_column_ids) {
+    result->add_column_definition(_table->column_name(column_id), _table->column_type(column_id));
+  }
+  const auto& group_order = _group_index->group_order();
+  _group_index->add_result_columns(group_order, chunk);
+
+  for (size_t index = 0; index < _aggregates.size(); ++index) {
+    const auto& aggregate = _aggregates[index];
+    result->add_column_definition(
+        aggregate_function_name(aggregate.function) + "(" + _table->column_name(aggregate.column_id) + ")",
+        _states[index]->result_type());
+    chunk.add_column(_states[index]->result_column(group_order));
+  }
+
+  result->emplace_chunk(std::move(chunk));
+  return result;
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAggregateState;
+class BaseGroupIndex;
+class Table;
+
+enum class AggregateFunction { Count, Sum, Min, Max, Avg };
+
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// An aggregate over a table that only grows, e.g., through Table::append, such as a minute-level rollup of an event
+// table. Instead of aggregating the whole table on every refresh, the running aggregates of all groups are kept and
+// refresh() only processes the rows that were added since the last refresh. These are found by a watermark, the
+// position of the first row that has not been aggregated yet. Changes to rows before the watermark are not noticed,
+// but chunks may be compressed.
+class MaterializedAggregate : private Noncopyable {
+ public:
+  MaterializedAggregate(std::shared_ptr<const Table> table, const std::vector<ColumnID>& group_by_column_ids,
+                        const std::vector<AggregateDefinition>& aggregates);
+  ~MaterializedAggregate();
+
+  // Aggregates the rows that were added since the last refresh and returns the result. It holds one row per group,
+  // ordered by the group-by columns, which are followed by one column per aggregate (e.g., "SUM(b)"). Count and Sum
+  // of integers are longs, Avg and Sum of floating point numbers are doubles. Without rows, the result is empty. If
+  // no rows were added, the previous result is returned, otherwise a new table (the cost of which only depends on the
+  // number of groups).
+  std::shared_ptr<Table> refresh();
+
+  // returns the result of the last refresh
+  std::shared_ptr<Table> result() const;
+
+  // returns the position of the first row that has not been aggregated yet
+  RowID watermark() const;
+
+  // returns the table that is aggregated
+  std::shared_ptr<const Table> table() const;
+
+ protected:
+  std::shared_ptr<Table> _build_result();
+
+  const std::shared_ptr<const Table> _table;
+  const std::vector<ColumnID> _group_by_column_ids;
+  const std::vector<AggregateDefinition> _aggregates;
+
+  // The ids of the groups are the positions of their aggregates in the states
+  std::unique_ptr<BaseGroupIndex> _group_index;
+  std::vector<std::unique_ptr<BaseAggregateState>> _states;
+
+  RowID _watermark{ChunkID{0}, 0};
+  uint64_t _aggregated_row_count = 0;
+  std::shared_ptr<Table> _result;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#include "numa_placement.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if OPOSSUM_NUMA_SUPPORT
+#include <numaif.h>
+#include <unistd.h>
+#endif
+
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/span.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+#if OPOSSUM_NUMA_SUPPORT
+// Moves the pages holding the values to the given node. The range is extended to whole pages, so parts of neighbouring
+// allocations might be moved as well, which only affects their performance.
+template <typename T>
+void move_to_numa_node(const Span<T> values, const NodeID numa_node_id) {
+  if (values.empty() || numa_node_id.t >= sizeof(unsigned long) * 8) return;  // NOLINT(runtime/int)
+
+  static const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(values.data()) & ~(page_size - 1);
+  const auto end = reinterpret_cast<uintptr_t>(values.data() + values.size());
+
+  // MPOL_PREFERRED instead of MPOL_BIND, because later allocations on the same pages should not be restricted
+  const auto node_mask = 1ul << numa_node_id.t;
+  mbind(reinterpret_cast<void*>(begin), end - begin, MPOL_PREFERRED, &node_mask, sizeof(node_mask) * 8,
+        MPOL_MF_MOVE);
+}
+
+void move_attribute_vector_to_numa_node(const BaseAttributeVector& attribute_vector, const NodeID numa_node_id) {
+  if (const auto vector = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    move_to_numa_node(vector->value_ids(), numa_node_id);
+  } else if (const auto vector = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    move_to_numa_node(vector->value_ids(), numa_node_id);
+  } else if (const auto vector = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    move_to_numa_node(vector->value_ids(), numa_node_id);
+  }
+}
+
+void move_chunk_to_numa_node(const Table& table, const Chunk& chunk, const NodeID numa_node_id) {
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    const auto column = chunk.get_column(column_id);
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // For strings, only the string objects are moved, not the heap memory of longer strings
+      if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<ColumnDataType>>(column)) {
+        move_to_numa_node(value_column->values(), numa_node_id);
+      } else if (const auto dictionary_column =
+                     std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(column)) {
+        move_to_numa_node(Span<ColumnDataType>{*dictionary_column->dictionary()}, numa_node_id);
+        move_attribute_vector_to_numa_node(*dictionary_column->attribute_vector(), numa_node_id);
+      }
+    });
+  }
+}
+#endif
+
+}  // namespace
+
+NodeID numa_node_for_chunk(const ChunkID chunk_id, const ChunkID chunk_count, const size_t node_count,
+                           const NumaPlacementPolicy policy) {
+  DebugAssert(node_count > 0, "There has to be at least one node");
+
+  switch (policy) {
+    case NumaPlacementPolicy::RoundRobin:
+      return NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)};
+    case NumaPlacementPolicy::ChunkRanges:
+      return NodeID{static_cast<NodeID::base_type>(uint64_t{chunk_id} * node_count / chunk_count)};
+    default:
+      Fail("Unknown placement policy");
+      return INVALID_NODE_ID;
+  }
+}
+
+void place_chunks_on_nodes(Table& table, const Topology& topology, const NumaPlacementPolicy policy) {
+  const auto chunk_count = table.chunk_count();
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& chunk = table.get_chunk(chunk_id);
+    const auto node_id = numa_node_for_chunk(chunk_id, chunk_count, topology.node_count(), policy);
+    chunk.set_node_id(node_id);
+
+#if OPOSSUM_NUMA_SUPPORT
+    if (!topology.is_fake()) move_chunk_to_numa_node(table, chunk, topology.nodes()[node_id].numa_node_id);
+#endif
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class Topology;
+
+enum class NumaPlacementPolicy {
+  RoundRobin,  // chunk i is placed on node i % node_count, which spreads every range of chunks over all nodes
+  ChunkRanges  // the chunks are split into one contiguous range per node, which keeps neighbouring chunks together
+};
+
+// returns the node (as an index into the Topology) that the policy assigns the given chunk to
+NodeID numa_node_for_chunk(const ChunkID chunk_id, const ChunkID chunk_count, const size_t node_count,
+                           const NumaPlacementPolicy policy);
+
+// Assigns every chunk of the table to a node of the topology (see Chunk::node_id), so that chunk-wise operators
+// process it on workers of that node. If the topology describes actual NUMA nodes, the memory of the chunk's
+// ValueColumns and DictionaryColumns is also moved to the node. This is best effort: pages that cannot be moved stay
+// where they are. Chunks that are added or compressed later allocate their memory wherever the allocating thread runs,
+// so tables should be placed once they are complete.
+void place_chunks_on_nodes(Table& table, const Topology& topology,
+                           const NumaPlacementPolicy policy = NumaPlacementPolicy::RoundRobin);
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include "reference_column.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  DebugAssert(referenced_column_id < referenced_table->col_count(), "referenced column does not exist");
+}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  const auto& row_id = _pos_list->at(i);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceColumn::size() const { return _pos_list->size(); }
+
+size_t ReferenceColumn::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(PosList) + _pos_list->capacity() * sizeof(RowID);
+}
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
+
+Chunk create_reference_chunk(const std::shared_ptr<const Table> table, const std::shared_ptr<const PosList> pos_list) {
+  Chunk chunk;
+
+  // Collect the input chunks that the positions point into. Operators usually pass positions of a single chunk.
+  std::vector<ChunkID> chunk_ids;
+  for (const auto& row_id : *pos_list) {
+    if (chunk_ids.empty() || chunk_ids.back() != row_id.chunk_id) chunk_ids.push_back(row_id.chunk_id);
+  }
+  std::sort(chunk_ids.begin(), chunk_ids.end());
+  chunk_ids.erase(std::unique(chunk_ids.begin(), chunk_ids.end()), chunk_ids.end());
+
+  // Columns of the same input chunk usually share their position list. We resolve every distinct combination of
+  // input position lists only once and let the output columns share the result.
+  std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  // Without positions, the first chunk tells whether a column holds data or references. A table without rows may only
+  // have an empty chunk without columns.
+  const auto& first_chunk = table->get_chunk(chunk_ids.empty() ? ChunkID{0} : chunk_ids.front());
+
+  for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+    // Columns holding data are referenced directly. Evictable chunks always hold data, so their columns are not loaded
+    // to check.
+    const auto first_column = column_id < first_chunk.col_count() && !first_chunk.is_evictable()
+                                  ? std::dynamic_pointer_cast<const ReferenceColumn>(first_chunk.get_column(column_id))
+                                  : nullptr;
+    if (!first_column) {
+      chunk.add_column(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+      continue;
+    }
+
+    // Without positions, the column references the same table as the column of a chunk with positions would
+    if (chunk_ids.empty()) {
+      chunk.add_column(std::make_shared<ReferenceColumn>(first_column->referenced_table(),
+                                                         first_column->referenced_column_id(), pos_list));
+      continue;
+    }
+
+    std::vector<std::shared_ptr<const ReferenceColumn>> input_columns;
+    std::vector<std::shared_ptr<const PosList>> input_pos_lists;
+    input_columns.reserve(chunk_ids.size());
+    input_pos_lists.reserve(chunk_ids.size());
+
+    for (const auto& chunk_id : chunk_ids) {
+      auto column = std::dynamic_pointer_cast<const ReferenceColumn>(table->get_chunk(chunk_id).get_column(column_id));
+      Assert(column, "A column must either consist of ReferenceColumns in all chunks or in none");
+      DebugAssert(input_columns.empty() || column->referenced_table() == input_columns.front()->referenced_table(),
+                  "All chunks of a column must reference the same table");
+      input_pos_lists.push_back(column->pos_list());
+      input_columns.push_back(std::move(column));
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list) {
+      auto new_pos_list = std::make_shared<PosList>();
+      new_pos_list->reserve(pos_list->size());
+
+      auto current_chunk_id = INVALID_CHUNK_ID;
+      const PosList* current_input_pos_list = nullptr;
+      for (const auto& row_id : *pos_list) {
+        if (row_id.chunk_id != current_chunk_id) {
+          current_chunk_id = row_id.chunk_id;
+          const auto chunk_index =
+              std::lower_bound(chunk_ids.cbegin(), chunk_ids.cend(), current_chunk_id) - chunk_ids.cbegin();
+          current_input_pos_list = input_pos_lists[chunk_index].get();
+        }
+        new_pos_list->push_back((*current_input_pos_list)[row_id.chunk_offset]);
+      }
+      resolved_pos_list = std::move(new_pos_list);
+    }
+
+    const auto& input_column = input_columns.front();
+    chunk.add_column(std::make_shared<ReferenceColumn>(input_column->referenced_table(),
+                                                       input_column->referenced_column_id(), resolved_pos_list));
+  }
+
+  return chunk;
+}
+
+}  // namespace opossum
@@ -30,10 +30,24 @@ class ReferenceColumn : public BaseColumn {
 
   size_t size() const override;
 
+  // only counts the position list, which might be shared with other columns
+  size_t estimate_memory_usage() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
+// Creates a chunk that holds a ReferenceColumn for every column of the given table, each containing the rows listed
+// in pos_list. Where the table's columns already are ReferenceColumns, the positions are resolved first so that the
+// new columns point to the table holding the actual data instead of building chains of references. This also holds
+// for an empty pos_list.
+Chunk create_reference_chunk(const std::shared_ptr<const Table> table, const std::shared_ptr<const PosList> pos_list);
+
 }  // namespace opossum
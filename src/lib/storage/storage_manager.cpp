@@ -1,14 +1,29 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "scheduler/chunk_jobs.hpp"
+#include "storage/binary_table_file.hpp"
+#include "storage/materialized_aggregate.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+constexpr char snapshot_magic[] = {'O', 'P', 'S', 'S'};
+
+// The number of chunks that are serialized before they are written, which bounds the memory used for their buffers
+constexpr size_t snapshot_batch_size = 256;
+
+}  // namespace
+
 StorageManager& StorageManager::get() { return *StorageManager::_instance_ptr(); }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) { this->_tables[name] = table; }
@@ -16,6 +31,23 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
 void StorageManager::drop_table(const std::string& name) {
   size_t erased = this->_tables.erase(name);
   DebugAssert(erased == 1, "exactly one table dropped");
+  this->_materialized_aggregates.erase(name);
+}
+
+void StorageManager::add_materialized_aggregate(const std::string& name,
+                                                std::shared_ptr<MaterializedAggregate> aggregate) {
+  this->add_table(name, aggregate->refresh());
+  this->_materialized_aggregates[name] = aggregate;
+}
+
+std::shared_ptr<MaterializedAggregate> StorageManager::get_materialized_aggregate(const std::string& name) const {
+  return this->_materialized_aggregates.at(name);
+}
+
+void StorageManager::refresh_materialized_aggregates() {
+  for (auto& entry : this->_materialized_aggregates) {
+    this->_tables[entry.first] = entry.second->refresh();
+  }
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return this->_tables.at(name); }
@@ -31,6 +63,80 @@ std::vector<std::string> StorageManager::table_names() const {
   return keys;
 }
 
+void StorageManager::write_snapshot(std::ostream& out) const {
+  out.write(snapshot_magic, sizeof(snapshot_magic));
+  const auto table_count = static_cast<uint32_t>(this->_tables.size());
+  out.write(reinterpret_cast<const char*>(&table_count), sizeof(table_count));
+
+  struct SnapshotChunk {
+    const std::string* table_name;
+    const Table* table;
+    ChunkID chunk_id;
+  };
+  std::vector<SnapshotChunk> chunks;
+  for (const auto& entry : this->_tables) {
+    for (ChunkID chunk_id{0}; chunk_id < entry.second->chunk_count(); ++chunk_id) {
+      chunks.push_back({&entry.first, entry.second.get(), chunk_id});
+    }
+  }
+
+  std::vector<std::string> buffers;
+  for (auto batch_begin = size_t{0}; batch_begin < chunks.size(); batch_begin += snapshot_batch_size) {
+    const auto batch_end = std::min(batch_begin + snapshot_batch_size, chunks.size());
+    buffers.assign(batch_end - batch_begin, std::string());
+
+    // Chunks are aligned relative to their own beginning, so their buffers can simply be concatenated
+    for_each_in_parallel(batch_end - batch_begin, [&](const size_t index) {
+      const auto& chunk = chunks[batch_begin + index];
+      std::ostringstream buffer;
+      write_binary_chunk(chunk.table->column_types(), chunk.table->get_chunk(chunk.chunk_id), buffer);
+      buffers[index] = buffer.str();
+    });
+
+    for (auto index = batch_begin; index < batch_end; ++index) {
+      const auto& chunk = chunks[index];
+      if (chunk.chunk_id == 0) {
+        const auto name_size = static_cast<uint32_t>(chunk.table_name->size());
+        out.write(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+        out.write(chunk.table_name->data(), name_size);
+        write_binary_table_header(*chunk.table, out);
+      }
+      const auto& buffer = buffers[index - batch_begin];
+      out.write(buffer.data(), buffer.size());
+    }
+  }
+  Assert(out.good(), "Could not write the snapshot");
+}
+
+void StorageManager::write_snapshot(const std::string& file_name) const {
+  std::ofstream out(file_name, std::ios::binary);
+  Assert(out.is_open(), "Could not create snapshot " + file_name);
+  this->write_snapshot(out);
+}
+
+void StorageManager::load_snapshot(std::istream& in) {
+  char magic[sizeof(snapshot_magic)];
+  in.read(magic, sizeof(magic));
+  Assert(in.good() && std::equal(magic, magic + sizeof(magic), snapshot_magic), "Not a snapshot");
+
+  uint32_t table_count;
+  in.read(reinterpret_cast<char*>(&table_count), sizeof(table_count));
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    uint32_t name_size;
+    in.read(reinterpret_cast<char*>(&name_size), sizeof(name_size));
+    std::string name(name_size, '\0');
+    in.read(name.data(), name_size);
+    Assert(in.good(), "Snapshot is truncated");
+    this->add_table(name, read_binary_table(in));
+  }
+}
+
+void StorageManager::load_snapshot(const std::string& file_name) {
+  std::ifstream in(file_name, std::ios::binary);
+  Assert(in.is_open(), "Could not open snapshot " + file_name);
+  this->load_snapshot(in);
+}
+
 void StorageManager::print(std::ostream& out) const {
   for (auto& entry : this->_tables) {
     this->_print_table(out, entry.first, entry.second);
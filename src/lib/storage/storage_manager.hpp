@@ -11,6 +11,8 @@
 
 namespace opossum {
 
+class MaterializedAggregate;
+
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
 class StorageManager : private Noncopyable {
@@ -20,9 +22,20 @@ class StorageManager : private Noncopyable {
   // adds a table to the storage manager
   void add_table(const std::string& name, std::shared_ptr<Table> table);
 
-  // removes the table from the storage manger
+  // removes the table from the storage manger, along with the materialized aggregate it might be the result of
   void drop_table(const std::string& name);
 
+  // Adds the result of the materialized aggregate as a table with the given name. The table is replaced by the new
+  // result whenever refresh_materialized_aggregates() is called.
+  void add_materialized_aggregate(const std::string& name, std::shared_ptr<MaterializedAggregate> aggregate);
+
+  // returns the materialized aggregate whose result is the table with the given name
+  std::shared_ptr<MaterializedAggregate> get_materialized_aggregate(const std::string& name) const;
+
+  // Aggregates the rows that were appended to the tables of all materialized aggregates since their last refresh and
+  // updates the result tables
+  void refresh_materialized_aggregates();
+
   // returns the table instance with the given name
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
@@ -32,6 +45,17 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
+  // Writes all tables to a snapshot, e.g., for backups. The chunks of all tables are serialized concurrently (see
+  // for_each_in_parallel) into separate buffers, a bounded number at a time, which are then written in order. The
+  // tables are stored in the layout of binary table files (see write_binary_table), so DictionaryColumns stay encoded
+  // and do not need to be compressed again when the snapshot is loaded. The tables must not be modified meanwhile.
+  void write_snapshot(std::ostream& out) const;
+  void write_snapshot(const std::string& file_name) const;
+
+  // adds the tables of a snapshot, replacing tables with the same names
+  void load_snapshot(std::istream& in);
+  void load_snapshot(const std::string& file_name);
+
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
@@ -46,6 +70,7 @@ class StorageManager : private Noncopyable {
 
  protected:
   std::map<std::string, std::shared_ptr<Table>> _tables;
+  std::map<std::string, std::shared_ptr<MaterializedAggregate>> _materialized_aggregates;
 
  protected:
   void _print_table(std::ostream& out, const std::string& name, std::shared_ptr<Table> table) const;
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "dictionary_column.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
@@ -17,13 +18,14 @@
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _max_chunk_size(chunk_size) {
+Table::Table(const uint32_t chunk_size) : _max_chunk_size(chunk_size), _version(next_storage_version()) {
   this->_chunks.push_back(std::make_shared<Chunk>());
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
   this->_column_names.push_back(name);
   this->_column_types.push_back(type);
+  this->_increment_version();
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
@@ -39,6 +41,20 @@ void Table::append(std::vector<AllTypeVariant> values) {
   DebugAssert(!this->_chunks.empty(), "chunks must not be empty");
   auto chunk = _get_insert_chunk();
   chunk->append(values);
+  this->_increment_version();
+}
+
+void Table::_emplace_value_columns(std::vector<std::shared_ptr<BaseColumn>> columns) {
+  auto chunk = std::make_shared<Chunk>();
+  for (ColumnID column_id{0}; column_id < this->col_count(); ++column_id) {
+    resolve_data_type(this->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      Assert(std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(columns[column_id]),
+             "append_columns: Values must have the type of column " + this->column_name(column_id));
+    });
+    chunk->add_column(std::move(columns[column_id]));
+  }
+  this->emplace_chunk(std::move(chunk));
 }
 
 void Table::create_new_chunk() {
@@ -50,13 +66,15 @@ void Table::create_new_chunk() {
   }
 
   this->_chunks.push_back(chunk);
+  this->_increment_version();
 }
 
 uint16_t Table::col_count() const { return this->_column_names.size(); }
 
 uint64_t Table::row_count() const {
-  return std::accumulate(this->_chunks.cbegin(), this->_chunks.cend(), 0,
-                         [](uint64_t sum, const auto chunk) { return sum + chunk->size(); });
+  return std::accumulate(this->_chunks.cbegin(), this->_chunks.cend(), 0, [](uint64_t sum, const auto& chunk) {
+    return sum + std::atomic_load(&chunk)->size();
+  });
 }
 
 ChunkID Table::chunk_count() const { return ChunkID(this->_chunks.size()); }
@@ -71,6 +89,8 @@ uint32_t Table::chunk_size() const { return this->_max_chunk_size; }
 
 const std::vector<std::string>& Table::column_names() const { return this->_column_names; }
 
+const std::vector<std::string>& Table::column_types() const { return this->_column_types; }
+
 const std::string& Table::column_name(ColumnID column_id) const { return this->_column_names.at(column_id); }
 
 const std::string& Table::column_type(ColumnID column_id) const { return this->_column_types.at(column_id); }
@@ -81,30 +101,79 @@ const Chunk& Table::get_chunk(ChunkID chunk_id) const { return this->_get_chunk(
 
 bool Table::_chunk_size_unlimited() const { return this->_max_chunk_size == 0; }
 
-Chunk& Table::_get_chunk(ChunkID chunk_id) const {
-  auto chunk = this->_chunks.at(chunk_id);
-  return *chunk;
-}
+Chunk& Table::_get_chunk(ChunkID chunk_id) const { return *std::atomic_load(&this->_chunks.at(chunk_id)); }
 
 std::shared_ptr<Chunk> Table::_get_insert_chunk() {
   DebugAssert(!this->_chunks.empty(), "chunks must not be empty");
 
   auto last = this->_chunks.back();
-  if (this->_chunk_size_unlimited()) {
+  if (this->_chunk_size_unlimited() && !last->is_evictable()) {
     return last;
   }
 
-  if (last->size() == this->_max_chunk_size) {
+  if (last->size() == this->_max_chunk_size || last->is_evictable()) {
     this->create_new_chunk();
   }
 
   return this->_chunks.back();
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+std::shared_ptr<Chunk> Table::get_shared_chunk(ChunkID chunk_id) const {
+  return std::atomic_load(&this->_chunks.at(chunk_id));
+}
+
+void Table::emplace_chunk(Chunk chunk) { this->emplace_chunk(std::make_shared<Chunk>(std::move(chunk))); }
+
+void Table::emplace_chunk(std::shared_ptr<Chunk> chunk) {
+  if (this->_chunks.size() == 1 && this->_chunks.front()->size() == 0) {
+    this->_chunks.front() = std::move(chunk);
+  } else {
+    this->_chunks.push_back(std::move(chunk));
+  }
+  this->_increment_version();
+}
+
+void Table::compress_chunk(ChunkID chunk_id) {
+  const auto chunk = this->get_shared_chunk(chunk_id);
+  Assert(!chunk->is_evictable(), "Evictable chunks cannot be compressed, compress them before calling make_evictable");
+
+  // The chunk may be shared with other tables (see get_shared_chunk), so it is replaced by a new chunk instead of being
+  // changed in place. The new chunk has a new version. The pointer is swapped atomically, so that readers that pinned
+  // the old chunk through get_shared_chunk keep it alive until they are done.
+  auto compressed_chunk = std::make_shared<Chunk>();
+  for (ColumnID column_id{0}; column_id < chunk->col_count(); ++column_id) {
+    compressed_chunk->add_column(make_shared_by_column_type<BaseColumn, DictionaryColumn>(
+        this->column_type(column_id), chunk->get_column(column_id)));
+  }
+
+  compressed_chunk->set_node_id(chunk->node_id());
+  std::atomic_store(&this->_chunks[chunk_id], std::shared_ptr<Chunk>(std::move(compressed_chunk)));
+  this->_increment_version();
+}
+
+void Table::make_evictable(const std::string& file_prefix, const BlockCompression compression) {
+  for (ChunkID chunk_id{0}; chunk_id < this->chunk_count(); ++chunk_id) {
+    auto& chunk = this->_get_chunk(chunk_id);
+    if (chunk.is_evictable()) continue;
+    chunk.make_evictable(this->_column_types, file_prefix + std::to_string(chunk_id), compression);
+  }
+}
+
+uint64_t Table::version() const {
+  // Versions only increase, so the table's version is that of its most recent change, including the chunks' ones
+  auto version = this->_version;
+  for (const auto& chunk : this->_chunks) version = std::max(version, std::atomic_load(&chunk)->version());
+  return version;
+}
+
+std::vector<ChunkID> Table::chunks_changed_since(const uint64_t version) const {
+  std::vector<ChunkID> chunk_ids;
+  for (ChunkID chunk_id{0}; chunk_id < this->chunk_count(); ++chunk_id) {
+    if (this->get_shared_chunk(chunk_id)->version() > version) chunk_ids.push_back(chunk_id);
+  }
+  return chunk_ids;
 }
 
-void Table::compress_chunk(ChunkID chunk_id) { throw std::runtime_error("TODO"); }
+void Table::_increment_version() { this->_version = next_storage_version(); }
 
 }  // namespace opossum
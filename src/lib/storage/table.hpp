@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -9,6 +11,7 @@
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "value_column.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -42,16 +45,28 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
+  // Returns the chunk with the given id. The reference is only valid while the chunk is part of the table, which
+  // compress_chunk ends. Readers that may run concurrently with compress_chunk pin the chunk via get_shared_chunk.
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
+  // returns the chunk with the given id as a pointer so that another table can share it (see emplace_chunk) or a
+  // reader can keep it alive while the table replaces it
+  std::shared_ptr<Chunk> get_shared_chunk(ChunkID chunk_id) const;
+
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   void emplace_chunk(Chunk chunk);
 
+  // Adds a chunk that might also be part of other tables, e.g., when an operator passes on the chunks of its input.
+  // As with the chunk above, the first chunk is replaced if it is empty.
+  void emplace_chunk(std::shared_ptr<Chunk> chunk);
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
+  // Returns a list of all column types.
+  const std::vector<std::string>& column_types() const;
+
   // returns the column name of the nth column
   const std::string& column_name(ColumnID column_id) const;
 
@@ -76,24 +91,77 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and not thread-safe and should be used for testing purposes only, see append_columns
   void append(std::vector<AllTypeVariant> values);
 
+  // Appends rows given as one vector of values per column, each of the data type of its column (e.g.,
+  // std::vector<int32_t> for an int column). The values are moved into ValueColumns of new chunks with at most
+  // chunk_size() rows each, so they are neither copied nor converted to AllTypeVariant if they fit into one chunk.
+  // The rows are not added to the last chunk, even if it has room for them (see emplace_chunk), so this is meant for
+  // large batches. Like append, this is not thread-safe.
+  template <typename... Types>
+  void append_columns(std::vector<Types>... values) {
+    Assert(sizeof...(Types) == this->col_count(), "append_columns: Values are required for every column");
+    const auto row_count = std::max({size_t{0}, values.size()...});
+    Assert(((values.size() == row_count) && ...), "append_columns: All columns need the same number of rows");
+
+    const auto rows_per_chunk = this->_chunk_size_unlimited() ? row_count : this->_max_chunk_size;
+    for (auto begin = size_t{0}; begin < row_count; begin += rows_per_chunk) {
+      const auto end = std::min(begin + rows_per_chunk, row_count);
+      this->_emplace_value_columns({_create_value_column(values, begin, end)...});
+    }
+  }
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueColumn into a DictionaryColumn
+  // compresses a ValueColumn into a DictionaryColumn. The chunk is replaced by a new one, so tables that share the
+  // chunk (see get_shared_chunk) keep the uncompressed one. Concurrent readers must hold the chunk through
+  // get_shared_chunk, references obtained through get_chunk may become invalid. Other modifications of the table must
+  // not run concurrently. Evictable chunks cannot be compressed.
   void compress_chunk(ChunkID chunk_id);
 
+  // Makes all chunks evictable (see Chunk::make_evictable), storing them in files named <file_prefix><chunk id>, so
+  // that only the chunks that are accessed need to stay in memory. Rows are appended to a new chunk afterwards. Chunks
+  // have to be compressed first. The compression applies to the files (see Chunk::make_evictable).
+  void make_evictable(const std::string& file_prefix, const BlockCompression compression = BlockCompression::None);
+
+  // Returns a number that increases whenever the table is modified through one of the methods above or one of its
+  // chunks changes (see Chunk::version), e.g., so that a cached result computed from the table can be recognized as
+  // outdated. Versions are unique across all tables and chunks, so a table that replaces another one under the same
+  // name never has a version the other one had. Changes made directly to a column are not noticed.
+  uint64_t version() const;
+
+  // Returns the chunks that were added, appended to, or compressed after the table had the given version, so that,
+  // e.g., a materialized result only needs to process these
+  std::vector<ChunkID> chunks_changed_since(const uint64_t version) const;
+
  protected:
   const uint32_t _max_chunk_size;
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  uint64_t _version;
 
  protected:
   bool _chunk_size_unlimited() const;
   Chunk& _get_chunk(ChunkID chunk_id) const;
   std::shared_ptr<Chunk> _get_insert_chunk();
+
+  // gives the table a new version, see version()
+  void _increment_version();
+
+  // adds a chunk with the given columns after checking that they are ValueColumns of the columns' types
+  void _emplace_value_columns(std::vector<std::shared_ptr<BaseColumn>> columns);
+
+  // Returns a ValueColumn with the values in [begin, end). The values are moved, the vector is only kept as a whole if
+  // it is not split up.
+  template <typename T>
+  static std::shared_ptr<BaseColumn> _create_value_column(std::vector<T>& values, const size_t begin,
+                                                          const size_t end) {
+    if (begin == 0 && end == values.size()) return std::make_shared<ValueColumn<T>>(std::move(values));
+    return std::make_shared<ValueColumn<T>>(
+        std::vector<T>(std::make_move_iterator(values.begin() + begin), std::make_move_iterator(values.begin() + end)));
+  }
 };
 }  // namespace opossum
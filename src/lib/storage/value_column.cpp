@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,21 +17,53 @@ namespace opossum {
 template <typename T>
 ValueColumn<T>::ValueColumn() {}
 
+template <typename T>
+ValueColumn<T>::ValueColumn(std::vector<T>&& values) : _content(std::move(values)) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(const Span<T> values, std::shared_ptr<const void> owner)
+    : _external_values(values), _external_values_owner(std::move(owner)) {
+  DebugAssert(_external_values_owner, "External values need an owner");
+}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
 
-  return this->_content.at(i);
+  const auto values = this->values();
+  if (i >= values.size()) throw std::out_of_range("ValueColumn: Value does not exist");
+  return values[i];
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
+  if (this->_external_values_owner) {
+    this->_content.assign(this->_external_values.begin(), this->_external_values.end());
+    this->_external_values = Span<T>{};
+    this->_external_values_owner = nullptr;
+  }
   this->_content.push_back(type_cast<T>(val));
 }
 
 template <typename T>
 size_t ValueColumn<T>::size() const {
-  return this->_content.size();
+  return this->values().size();
+}
+
+template <typename T>
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + this->_content.capacity() * sizeof(T);
+}
+
+template <typename T>
+Span<T> ValueColumn<T>::values() const {
+  if (this->_external_values_owner) return this->_external_values;
+  return this->_content;
+}
+
+template <typename T>
+bool ValueColumn<T>::has_external_values() const {
+  return this->_external_values_owner != nullptr;
 }
 
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "utils/span.hpp"
 
 namespace opossum {
 
@@ -15,6 +16,13 @@ class ValueColumn : public BaseColumn {
  public:
   ValueColumn();
 
+  // creates a column holding the given values, e.g., the result of an operator's computation
+  explicit ValueColumn(std::vector<T>&& values);
+
+  // Creates a column whose values are held by someone else, e.g., a memory-mapped file (see MappedFile). The column
+  // keeps the owner alive as long as it reads from the values. Before a value is appended, the values are copied.
+  ValueColumn(const Span<T> values, std::shared_ptr<const void> owner);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
@@ -24,13 +32,22 @@ class ValueColumn : public BaseColumn {
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
-  // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
-  const std::vector<T>& values() const;
+  // e.g. const auto values = col.values(); and then: values[i]; in your loop.
+  Span<T> values() const;
+
+  // returns whether the values are held by someone else, see above
+  bool has_external_values() const;
 
  protected:
   std::vector<T> _content;
+
+  // if there is an owner, the values are read from _external_values instead of _content
+  Span<T> _external_values;
+  std::shared_ptr<const void> _external_values_owner;
 };
 
 }  // namespace opossum
@@ -0,0 +1,359 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/binary_table_file.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr char checkpoint_magic[] = {'O', 'P', 'C', 'P'};
+
+// A record consists of the size of its payload (uint32), its sequence number (uint64), its type (uint8), the payload,
+// and a checksum (uint32) of everything before it
+constexpr auto record_header_size = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint8_t);
+constexpr auto record_checksum_size = sizeof(uint32_t);
+
+template <typename T>
+void write_value(std::ostream& out, const T& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+void write_string(std::ostream& out, const std::string& value) {
+  write_value(out, static_cast<uint32_t>(value.size()));
+  out.write(value.data(), value.size());
+}
+
+template <typename T>
+T read_value(std::istream& in) {
+  auto value = T{};
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string read_string(std::istream& in) {
+  std::string value(read_value<uint32_t>(in), '\0');
+  in.read(value.data(), value.size());
+  return value;
+}
+
+// FNV-1a, which is enough to recognize records that were only written partially
+uint32_t checksum(const char* data, const size_t size) {
+  auto hash = uint32_t{2166136261u};
+  for (size_t index = 0; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool write_all(const int file_descriptor, const char* data, size_t size) {
+  while (size > 0) {
+    const auto written = write(file_descriptor, data, size);
+    if (written == -1) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+// makes the creation or renaming of files in the directory durable
+void sync_directory(const std::string& directory) {
+  const auto file_descriptor = open(directory.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "WriteAheadLog: Could not open directory " + directory);
+  fsync(file_descriptor);
+  close(file_descriptor);
+}
+
+}  // namespace
+
+WriteAheadLog::WriteAheadLog(const std::string& directory) : _directory(directory) {
+  if (mkdir(_directory.c_str(), 0755) == -1) {
+    Assert(errno == EEXIST, "WriteAheadLog: Could not create directory " + _directory);
+  }
+  _recover();
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  if (_file_descriptor != -1) close(_file_descriptor);
+}
+
+void WriteAheadLog::add_table(const std::string& name, const std::shared_ptr<Table>& table) {
+  std::ostringstream payload;
+  write_string(payload, name);
+  write_binary_table(*table, payload);
+
+  _log(RecordType::AddTable, payload.str(), [&]() { StorageManager::get().add_table(name, table); });
+}
+
+void WriteAheadLog::drop_table(const std::string& name) {
+  std::ostringstream payload;
+  write_string(payload, name);
+
+  _log(RecordType::DropTable, payload.str(), [&]() { StorageManager::get().drop_table(name); });
+}
+
+void WriteAheadLog::append(const std::string& table_name, const std::vector<AllTypeVariant>& values) {
+  append_rows(table_name, {values});
+}
+
+void WriteAheadLog::append_rows(const std::string& table_name,
+                                const std::vector<std::vector<AllTypeVariant>>& rows) {
+  const auto table = StorageManager::get().get_table(table_name);
+
+  // The rows are recorded as a chunk, so that they are written in their binary form
+  Chunk chunk;
+  for (const auto& column_type : table->column_types()) {
+    chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(column_type));
+  }
+  for (const auto& values : rows) chunk.append(values);
+
+  std::ostringstream payload;
+  write_string(payload, table_name);
+  write_binary_chunk(table->column_types(), chunk, payload);
+
+  _log(RecordType::AppendRows, payload.str(), [&]() {
+    for (const auto& values : rows) table->append(values);
+  });
+}
+
+void WriteAheadLog::emplace_chunk(const std::string& table_name, Chunk chunk) {
+  const auto table = StorageManager::get().get_table(table_name);
+  Assert(chunk.col_count() == table->col_count(), "WriteAheadLog: Chunk must have a column for each of the table");
+
+  std::ostringstream payload;
+  write_string(payload, table_name);
+  write_binary_chunk(table->column_types(), chunk, payload);
+
+  _log(RecordType::EmplaceChunk, payload.str(), [&]() { table->emplace_chunk(std::move(chunk)); });
+}
+
+void WriteAheadLog::checkpoint() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _write_checkpoint(lock);
+}
+
+void WriteAheadLog::set_checkpoint_interval(const size_t log_size) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _checkpoint_interval = log_size;
+}
+
+void WriteAheadLog::set_commit_delay(const std::chrono::microseconds commit_delay) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _commit_delay = commit_delay;
+}
+
+uint64_t WriteAheadLog::sync_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _sync_count;
+}
+
+void WriteAheadLog::_recover() {
+  auto checkpoint_sequence_number = uint64_t{0};
+
+  std::ifstream checkpoint_file(_directory + "/checkpoint.bin", std::ios::binary);
+  if (checkpoint_file.is_open()) {
+    char magic[sizeof(checkpoint_magic)];
+    checkpoint_file.read(magic, sizeof(magic));
+    Assert(std::equal(magic, magic + sizeof(magic), checkpoint_magic), "WriteAheadLog: Checkpoint is corrupt");
+
+    checkpoint_sequence_number = read_value<uint64_t>(checkpoint_file);
+    StorageManager::get().load_snapshot(checkpoint_file);
+  }
+  _sequence_number = checkpoint_sequence_number;
+
+  const auto log_file_name = _directory + "/wal.log";
+  std::string log;
+  {
+    std::ifstream log_file(log_file_name, std::ios::binary);
+    if (log_file.is_open()) log.assign(std::istreambuf_iterator<char>(log_file), std::istreambuf_iterator<char>());
+  }
+
+  auto position = size_t{0};
+  while (log.size() - position >= record_header_size + record_checksum_size) {
+    uint32_t payload_size;
+    std::memcpy(&payload_size, log.data() + position, sizeof(payload_size));
+    const auto record_size = record_header_size + payload_size + record_checksum_size;
+    if (log.size() - position < record_size) break;
+
+    uint32_t record_checksum;
+    std::memcpy(&record_checksum, log.data() + position + record_size - record_checksum_size, sizeof(uint32_t));
+    if (checksum(log.data() + position, record_size - record_checksum_size) != record_checksum) break;
+
+    uint64_t sequence_number;
+    std::memcpy(&sequence_number, log.data() + position + sizeof(uint32_t), sizeof(sequence_number));
+    const auto type = static_cast<RecordType>(log[position + sizeof(uint32_t) + sizeof(uint64_t)]);
+
+    // Records that are part of the checkpoint are left over from a crash while the checkpoint was written
+    if (sequence_number > checkpoint_sequence_number) {
+      _replay(type, log.substr(position + record_header_size, payload_size));
+      _sequence_number = sequence_number;
+    }
+    position += record_size;
+  }
+  _durable_sequence_number = _sequence_number;
+
+  // Partially written records are cut off, so that new records directly follow the valid ones
+  _file_descriptor = open(log_file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor != -1, "WriteAheadLog: Could not open " + log_file_name);
+  const auto truncated = ftruncate(_file_descriptor, position) == 0;
+  Assert(truncated, "WriteAheadLog: Could not truncate " + log_file_name);
+  _log_size = position;
+}
+
+void WriteAheadLog::_replay(const RecordType type, const std::string& payload) {
+  std::istringstream in(payload);
+  auto& storage_manager = StorageManager::get();
+  const auto table_name = read_string(in);
+
+  switch (type) {
+    case RecordType::AddTable:
+      storage_manager.add_table(table_name, read_binary_table(in));
+      break;
+    case RecordType::DropTable:
+      storage_manager.drop_table(table_name);
+      break;
+    case RecordType::AppendRows: {
+      const auto table = storage_manager.get_table(table_name);
+      const auto chunk = read_binary_chunk(table->column_types(), in);
+      std::vector<AllTypeVariant> values(chunk.col_count());
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+          values[column_id] = (*chunk.get_column(column_id))[chunk_offset];
+        }
+        table->append(values);
+      }
+      break;
+    }
+    case RecordType::EmplaceChunk: {
+      const auto table = storage_manager.get_table(table_name);
+      table->emplace_chunk(read_binary_chunk(table->column_types(), in));
+      break;
+    }
+    default:
+      Fail("WriteAheadLog: Unknown record type");
+  }
+}
+
+void WriteAheadLog::_log(const RecordType type, const std::string& payload, const std::function<void()>& apply) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_failed) Fail("WriteAheadLog: The log failed to write before");
+
+  // Changes that fail are not logged
+  apply();
+
+  const auto sequence_number = ++_sequence_number;
+  const auto record_begin = _buffer.size();
+  const auto payload_size = static_cast<uint32_t>(payload.size());
+  _buffer.append(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+  _buffer.append(reinterpret_cast<const char*>(&sequence_number), sizeof(sequence_number));
+  _buffer += static_cast<char>(type);
+  _buffer += payload;
+  const auto record_checksum = checksum(_buffer.data() + record_begin, _buffer.size() - record_begin);
+  _buffer.append(reinterpret_cast<const char*>(&record_checksum), sizeof(record_checksum));
+
+  while (_durable_sequence_number < sequence_number) {
+    // The records of a failed write, which may include ours, cannot be written again, as it is unknown which of them
+    // reached the file
+    if (_failed) Fail("WriteAheadLog: Could not write the log");
+
+    // Another thread is writing, our record is either part of its write or of the next one
+    if (_syncing) {
+      _synced.wait(lock);
+      continue;
+    }
+
+    _syncing = true;
+    if (_commit_delay.count() > 0) {
+      lock.unlock();
+      std::this_thread::sleep_for(_commit_delay);
+      lock.lock();
+    }
+
+    const auto records = std::move(_buffer);
+    _buffer.clear();
+    const auto synced_sequence_number = _sequence_number;
+
+    lock.unlock();
+    const auto written =
+        write_all(_file_descriptor, records.data(), records.size()) && fdatasync(_file_descriptor) == 0;
+    lock.lock();
+
+    _syncing = false;
+    _failed = !written;
+    _synced.notify_all();
+    if (_failed) Fail("WriteAheadLog: Could not write the log");
+
+    _log_size += records.size();
+    _durable_sequence_number = std::max(_durable_sequence_number, synced_sequence_number);
+    ++_sync_count;
+  }
+
+  if (_log_size >= _checkpoint_interval) _write_checkpoint(lock);
+}
+
+void WriteAheadLog::_write_checkpoint(std::unique_lock<std::mutex>& lock) {
+  // The log is truncated below, which must not happen while another thread writes to it
+  _synced.wait(lock, [&]() { return !_syncing; });
+
+  // The tables hold changes whose records could not be written, which must not become durable through the checkpoint
+  if (_failed) Fail("WriteAheadLog: The log failed to write before");
+
+  const auto file_name = _directory + "/checkpoint.bin";
+  const auto temporary_file_name = file_name + ".tmp";
+  {
+    std::ofstream out(temporary_file_name, std::ios::binary);
+    Assert(out.is_open(), "WriteAheadLog: Could not create " + temporary_file_name);
+
+    out.write(checkpoint_magic, sizeof(checkpoint_magic));
+    write_value(out, _sequence_number);
+    StorageManager::get().write_snapshot(out);
+    out.close();
+    Assert(!out.fail(), "WriteAheadLog: Could not write " + temporary_file_name);
+  }
+
+  const auto file_descriptor = open(temporary_file_name.c_str(), O_RDONLY);
+  const auto synced = file_descriptor != -1 && fsync(file_descriptor) == 0;
+  if (file_descriptor != -1) close(file_descriptor);
+  Assert(synced, "WriteAheadLog: Could not sync " + temporary_file_name);
+
+  // Renaming replaces the previous checkpoint atomically, so that a crash leaves either the old or the new one
+  const auto renamed = std::rename(temporary_file_name.c_str(), file_name.c_str()) == 0;
+  Assert(renamed, "WriteAheadLog: Could not replace " + file_name);
+  sync_directory(_directory);
+
+  // Buffered records are covered by the checkpoint, so whoever waits for them can return
+  const auto truncated = ftruncate(_file_descriptor, 0) == 0;
+  Assert(truncated, "WriteAheadLog: Could not truncate the log");
+  _buffer.clear();
+  _durable_sequence_number = _sequence_number;
+  _log_size = 0;
+  _synced.notify_all();
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Makes changes to the tables of the StorageManager durable. Changes made through the log are applied to the tables
+// and recorded in the file wal.log in the log's directory before the methods return. Changes made to the tables in any
+// other way are only durable once they are part of a checkpoint.
+//
+// Records are written with group commit: a thread whose record is not durable yet writes all records that are
+// buffered at that time and syncs the file once for all of them, while records of other threads are buffered until
+// the next sync. So concurrent writers share syncs, and a sync does not need to be paid for each row. A commit delay
+// lets the syncing thread wait for more records first.
+//
+// A checkpoint writes a snapshot of all tables of the StorageManager to the file checkpoint.bin (see
+// StorageManager::write_snapshot) and empties the log. Opening a log recovers the tables: it adds the tables of the
+// last checkpoint to the StorageManager and replays the records that were logged after it. A record that was only
+// written partially, e.g., because of a crash, is discarded together with everything after it.
+//
+// If the log cannot be written, the methods that were waiting for the failed write and all later calls fail, as
+// retrying the write could not tell which records reached the file. The changes are applied to the tables before they
+// are logged, so the tables may then hold changes that are not durable. Reopening the log recovers the durable state.
+//
+// All methods are thread-safe, changes to the tables are applied in the order in which they are logged.
+class WriteAheadLog : private Noncopyable {
+ public:
+  // opens the log in the directory, which is created if necessary, and recovers the tables
+  explicit WriteAheadLog(const std::string& directory);
+  ~WriteAheadLog();
+
+  // adds the table, including its rows, to the StorageManager
+  void add_table(const std::string& name, const std::shared_ptr<Table>& table);
+
+  void drop_table(const std::string& name);
+
+  // appends the row to the table as Table::append does
+  void append(const std::string& table_name, const std::vector<AllTypeVariant>& values);
+
+  // appends the rows to the table with a single record
+  void append_rows(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows);
+
+  // adds the chunk to the table (see Table::emplace_chunk), e.g., for bulk inserts
+  void emplace_chunk(const std::string& table_name, Chunk chunk);
+
+  // writes a checkpoint of all tables and empties the log
+  void checkpoint();
+
+  // Writes a checkpoint whenever the log has grown by this many bytes, so that recovery does not need to replay too
+  // many records. By default, checkpoints are only written by checkpoint().
+  void set_checkpoint_interval(const size_t log_size);
+
+  // lets the thread that syncs the log wait this long before writing, so that more records share the sync
+  void set_commit_delay(const std::chrono::microseconds commit_delay);
+
+  // returns the number of times the log was synced
+  uint64_t sync_count() const;
+
+ protected:
+  enum class RecordType : uint8_t { AddTable = 0, DropTable = 1, AppendRows = 2, EmplaceChunk = 3 };
+
+  void _recover();
+  void _replay(const RecordType type, const std::string& payload);
+
+  // Applies the change and buffers its record. Returns once the record is durable.
+  void _log(const RecordType type, const std::string& payload, const std::function<void()>& apply);
+
+  void _write_checkpoint(std::unique_lock<std::mutex>& lock);
+
+  const std::string _directory;
+  int _file_descriptor = -1;
+
+  // guards all members below
+  mutable std::mutex _mutex;
+  std::condition_variable _synced;
+
+  // records that were not written yet, the last record that was logged, and the last record that is durable
+  std::string _buffer;
+  uint64_t _sequence_number = 0;
+  uint64_t _durable_sequence_number = 0;
+  bool _syncing = false;
+  // set once a write failed, see above
+  bool _failed = false;
+
+  // the size of the log file, which restarts at 0 with every checkpoint
+  size_t _log_size = 0;
+  size_t _checkpoint_interval = std::numeric_limits<size_t>::max();
+  std::chrono::microseconds _commit_delay{0};
+  uint64_t _sync_count = 0;
+};
+
+}  // namespace opossum
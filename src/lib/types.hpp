@@ -31,12 +31,16 @@
 STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint32_t, NodeID);
 
 namespace opossum {
 
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
+constexpr NodeID INVALID_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -53,6 +57,8 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+enum class OrderByMode { Ascending, Descending };
+
 using PosList = std::vector<RowID>;
 
 class Noncopyable {
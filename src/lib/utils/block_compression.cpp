@@ -0,0 +1,150 @@
+#include "block_compression.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A sequence starts with a token whose upper four bits hold the number of literals and whose lower four bits hold the
+// length of the match minus min_match_length. A value of 15 means that bytes follow that are added to the length,
+// until one of them is smaller than 255. The literals follow, then the match's distance back (uint16), then the bytes
+// that extend the match length. The last sequence has no match.
+constexpr size_t min_match_length = 4;
+constexpr size_t max_match_distance = 65535;
+constexpr uint8_t token_length_limit = 15;
+
+constexpr size_t hash_bits = 14;
+
+// Every 2^search_skip_shift positions without a match, the search skips one more byte, so that incompressible data is
+// passed over quickly
+constexpr size_t search_skip_shift = 6;
+
+uint32_t load_uint32(const char* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+size_t hash_of(const uint32_t sequence) { return (sequence * 2654435761u) >> (32 - hash_bits); }
+
+void append_length(std::string& out, size_t length) {
+  while (length >= 255) {
+    out += static_cast<char>(255);
+    length -= 255;
+  }
+  out += static_cast<char>(length);
+}
+
+void append_sequence(std::string& out, const char* literals, const size_t literal_count, const size_t match_distance,
+                     const size_t match_length) {
+  const auto literal_token = std::min(literal_count, size_t{token_length_limit});
+  const auto match_token =
+      match_length == 0 ? 0 : std::min(match_length - min_match_length, size_t{token_length_limit});
+  out += static_cast<char>((literal_token << 4) | match_token);
+  if (literal_token == token_length_limit) append_length(out, literal_count - token_length_limit);
+  out.append(literals, literal_count);
+
+  if (match_length == 0) return;
+  const auto distance = static_cast<uint16_t>(match_distance);
+  out.append(reinterpret_cast<const char*>(&distance), sizeof(distance));
+  if (match_token == token_length_limit) append_length(out, match_length - min_match_length - token_length_limit);
+}
+
+// reads the remainder of a length that exceeds the token
+size_t read_length(const uint8_t*& position, const uint8_t* end) {
+  auto length = size_t{0};
+  while (true) {
+    if (position == end) Fail("Compressed block is corrupt");
+    const auto byte = *position++;
+    length += byte;
+    if (byte < 255) return length;
+  }
+}
+
+}  // namespace
+
+std::string compress_block(const char* data, const size_t size) {
+  std::string out;
+  out.reserve(size + size / 255 + 16);
+
+  // positions + 1 of the last occurrence of each hashed sequence, 0 if there was none
+  std::vector<uint32_t> last_positions(size_t{1} << hash_bits, 0);
+
+  auto literal_begin = size_t{0};
+  auto position = size_t{0};
+  auto misses = size_t{0};
+  while (position + min_match_length <= size) {
+    const auto sequence = load_uint32(data + position);
+    auto& last_position = last_positions[hash_of(sequence)];
+    const auto candidate = static_cast<size_t>(last_position) - 1;
+    const auto has_candidate = last_position != 0 && position - candidate <= max_match_distance;
+    last_position = static_cast<uint32_t>(position + 1);
+
+    if (!has_candidate || load_uint32(data + candidate) != sequence) {
+      position += 1 + (misses++ >> search_skip_shift);
+      continue;
+    }
+
+    auto match_length = min_match_length;
+    while (position + match_length < size && data[candidate + match_length] == data[position + match_length]) {
+      ++match_length;
+    }
+
+    append_sequence(out, data + literal_begin, position - literal_begin, position - candidate, match_length);
+    position += match_length;
+    literal_begin = position;
+    misses = 0;
+  }
+
+  append_sequence(out, data + literal_begin, size - literal_begin, 0, 0);
+  return out;
+}
+
+void decompress_block(const char* block, const size_t block_size, char* out, const size_t size) {
+  auto position = reinterpret_cast<const uint8_t*>(block);
+  const auto end = position + block_size;
+  auto out_position = size_t{0};
+
+  while (position < end) {
+    const auto token = *position++;
+
+    auto literal_count = static_cast<size_t>(token >> 4);
+    if (literal_count == token_length_limit) literal_count += read_length(position, end);
+    if (literal_count > static_cast<size_t>(end - position) || literal_count > size - out_position) {
+      Fail("Compressed block is corrupt");
+    }
+    std::memcpy(out + out_position, position, literal_count);
+    position += literal_count;
+    out_position += literal_count;
+
+    if (position == end) break;
+
+    if (end - position < 2) Fail("Compressed block is corrupt");
+    uint16_t distance;
+    std::memcpy(&distance, position, sizeof(distance));
+    position += sizeof(distance);
+
+    auto match_length = static_cast<size_t>(token & 0x0F);
+    if (match_length == token_length_limit) match_length += read_length(position, end);
+    match_length += min_match_length;
+    if (distance == 0 || distance > out_position || match_length > size - out_position) {
+      Fail("Compressed block is corrupt");
+    }
+
+    // Matches may overlap with the bytes they produce, e.g., to repeat a single byte, so they are copied bytewise
+    const auto match = out + out_position - distance;
+    for (size_t index = 0; index < match_length; ++index) out[out_position + index] = match[index];
+    out_position += match_length;
+  }
+
+  if (out_position != size) Fail("Compressed block is corrupt");
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace opossum {
+
+// Compression of blocks of bytes, e.g., of serialized columns that are stored on disk
+enum class BlockCompression { None, Lz };
+
+// Compresses the data with a fast LZ77 codec in the style of LZ4, which favors speed over the compression ratio: The
+// compressed block is a sequence of literals (bytes that are copied as they are), each followed by a match that
+// repeats up to 64 KiB earlier output. Matches are found through a hash table of four-byte sequences. The block does
+// not store the size of the data, which needs to be passed to decompress_block.
+std::string compress_block(const char* data, const size_t size);
+
+// Decompresses a block written by compress_block into `out`, which has room for the `size` bytes of the data. Fails if
+// the block is corrupt.
+void decompress_block(const char* block, const size_t block_size, char* out, const size_t size);
+
+}  // namespace opossum
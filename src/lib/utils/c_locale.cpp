@@ -0,0 +1,20 @@
+#include "c_locale.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+locale_t c_locale() {
+  static const auto locale = []() {
+    const auto locale = newlocale(LC_ALL_MASK, "C", nullptr);
+    Assert(locale != nullptr, "Could not create the C locale");
+    return locale;
+  }();
+  return locale;
+}
+
+ScopedCLocale::ScopedCLocale() : _previous_locale(uselocale(c_locale())) {}
+
+ScopedCLocale::~ScopedCLocale() { uselocale(_previous_locale); }
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <locale.h>
+#if defined(__APPLE__)
+#include <xlocale.h>
+#endif
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the "C" locale, in which the C library reads and writes numbers the same way regardless of the locale the
+// program runs in, e.g., with '.' as the decimal separator. It is created on the first call and used with the *_l
+// functions such as strtod_l.
+locale_t c_locale();
+
+// Makes the C library functions that have no *_l variant, such as snprintf, use the "C" locale on the calling thread
+// while the guard exists
+class ScopedCLocale : private Noncopyable {
+ public:
+  ScopedCLocale();
+  ~ScopedCLocale();
+
+ protected:
+  const locale_t _previous_locale;
+};
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#include "cpu_time.hpp"
+
+#include <time.h>
+
+#include <chrono>
+#include <thread>
+
+namespace opossum {
+
+namespace {
+
+thread_local JobCpuTime* current_job_cpu_time = nullptr;
+
+}  // namespace
+
+std::chrono::nanoseconds thread_cpu_time() {
+  timespec time;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+JobCpuTime::JobCpuTime() : _previous(current_job_cpu_time), _thread_id(std::this_thread::get_id()) {
+  current_job_cpu_time = this;
+}
+
+JobCpuTime::~JobCpuTime() { current_job_cpu_time = _previous; }
+
+JobCpuTime* JobCpuTime::current() { return current_job_cpu_time; }
+
+void JobCpuTime::add(const std::thread::id thread_id, const std::chrono::nanoseconds cpu_time) {
+  if (thread_id != _thread_id) _nanoseconds += cpu_time.count();
+}
+
+std::chrono::nanoseconds JobCpuTime::get() const { return std::chrono::nanoseconds{_nanoseconds.load()}; }
+
+}  // namespace opossum
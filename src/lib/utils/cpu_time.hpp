@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// returns the CPU time that the calling thread has consumed so far
+std::chrono::nanoseconds thread_cpu_time();
+
+// Collects the CPU time that an operator's jobs consume on threads other than the one executing the operator, see
+// for_each_chunk_in_parallel. AbstractOperator::execute creates one, which is the current one of the executing thread
+// until it is destroyed. Jobs that run on the executing thread itself (e.g., while it waits for the other jobs) are
+// already part of that thread's CPU time.
+class JobCpuTime : private Noncopyable {
+ public:
+  JobCpuTime();
+  ~JobCpuTime();
+
+  // returns the instance of the operator that is executed by the calling thread, or nullptr
+  static JobCpuTime* current();
+
+  // adds the CPU time a job has consumed on the given thread
+  void add(const std::thread::id thread_id, const std::chrono::nanoseconds cpu_time);
+
+  std::chrono::nanoseconds get() const;
+
+ protected:
+  JobCpuTime* const _previous;
+  const std::thread::id _thread_id;
+  std::atomic<int64_t> _nanoseconds{0};
+};
+
+}  // namespace opossum
@@ -1,16 +1,150 @@
 #include "load_table.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "scheduler/chunk_jobs.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/c_locale.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
+namespace {
+
+// Size of the parts of a block that are searched for line ends by one job each
+constexpr auto line_search_part_size = size_t{1024} * 1024;
+
+// Parses the whole field as a number in the way std::from_chars does, i.e., without leading whitespace or '+'. The C
+// functions are used, as std::from_chars is only available from GCC 8 on, and for floating-point numbers from GCC 11.
+// Floating-point numbers are read in the "C" locale, so that they need a '.' whatever the locale of the program is.
+template <typename T>
+bool parse_number(const std::string_view field, T& value) {
+  // The C functions need a terminated string, numbers that do not fit are invalid anyway
+  char buffer[64];
+  if (field.empty() || field.size() >= sizeof(buffer) || field[0] == '+' ||
+      std::isspace(static_cast<unsigned char>(field[0]))) {
+    return false;
+  }
+  std::memcpy(buffer, field.data(), field.size());
+  buffer[field.size()] = '\0';
+
+  char* end = nullptr;
+  errno = 0;
+  if constexpr (std::is_same_v<T, int32_t>) {
+    const auto parsed = std::strtol(buffer, &end, 10);
+    if (parsed < std::numeric_limits<int32_t>::min() || parsed > std::numeric_limits<int32_t>::max()) return false;
+    value = static_cast<int32_t>(parsed);
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    value = std::strtoll(buffer, &end, 10);
+  } else if constexpr (std::is_same_v<T, float>) {
+    value = strtof_l(buffer, &end, c_locale());
+  } else {
+    static_assert(std::is_same_v<T, double>, "Unsupported number type");
+    value = strtod_l(buffer, &end, c_locale());
+  }
+  return errno == 0 && end == buffer + field.size();
+}
+
+class BaseColumnParser {
+ public:
+  virtual ~BaseColumnParser() = default;
+
+  // parses the value and adds it to the column
+  virtual void parse(const std::string_view field) = 0;
+
+  // returns a column that holds the parsed values
+  virtual std::shared_ptr<BaseColumn> create_column() = 0;
+};
+
+// Parses values directly into the vector of a ValueColumn, without going through AllTypeVariant
+template <typename T>
+class ColumnParser : public BaseColumnParser {
+ public:
+  explicit ColumnParser(const size_t row_count) { _values.reserve(row_count); }
+
+  void parse(const std::string_view field) override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.emplace_back(field);
+    } else {
+      auto value = T{};
+      if (!parse_number(field, value)) Fail("load_table: Could not parse value '" + std::string(field) + "'");
+      _values.push_back(value);
+    }
+  }
+
+  std::shared_ptr<BaseColumn> create_column() override { return std::make_shared<ValueColumn<T>>(std::move(_values)); }
+
+ protected:
+  std::vector<T> _values;
+};
+
+// Appends the positions of all line breaks in [begin, end) of the buffer to line_ends. Parts of the range are searched
+// in parallel.
+void find_line_ends(const std::string& buffer, const size_t begin, const size_t end, std::vector<size_t>& line_ends) {
+  const auto part_count = (end - begin + line_search_part_size - 1) / line_search_part_size;
+  std::vector<std::vector<size_t>> line_ends_by_part(part_count);
+
+  for_each_in_parallel(part_count, [&](const size_t part) {
+    const auto part_end = buffer.data() + std::min(begin + (part + 1) * line_search_part_size, end);
+    auto position = buffer.data() + begin + part * line_search_part_size;
+    while (const auto line_end = static_cast<const char*>(std::memchr(position, '\n', part_end - position))) {
+      line_ends_by_part[part].push_back(line_end - buffer.data());
+      position = line_end + 1;
+    }
+  });
+
+  for (const auto& part_line_ends : line_ends_by_part) {
+    line_ends.insert(line_ends.end(), part_line_ends.begin(), part_line_ends.end());
+  }
+}
+
+// Parses the lines with the indices [first_line, end_line) of the buffer into a chunk
+Chunk parse_chunk(const std::string& buffer, const std::vector<size_t>& line_ends, const size_t first_line,
+                  const size_t end_line, const std::vector<std::string>& column_types) {
+  const auto row_count = end_line - first_line;
+  std::vector<std::unique_ptr<BaseColumnParser>> parsers;
+  for (const auto& column_type : column_types) {
+    parsers.emplace_back(make_unique_by_column_type<BaseColumnParser, ColumnParser>(column_type, row_count));
+  }
+
+  auto line_begin = first_line == 0 ? size_t{0} : line_ends[first_line - 1] + 1;
+  for (auto line_index = first_line; line_index < end_line; ++line_index) {
+    const auto line = std::string_view{buffer}.substr(line_begin, line_ends[line_index] - line_begin);
+
+    auto field_begin = size_t{0};
+    for (const auto& parser : parsers) {
+      if (field_begin > line.size()) Fail("load_table: Line has too few values: " + std::string(line));
+      const auto field_end = std::min(line.find('|', field_begin), line.size());
+      parser->parse(line.substr(field_begin, field_end - field_begin));
+      field_begin = field_end + 1;
+    }
+
+    line_begin = line_ends[line_index] + 1;
+  }
+
+  Chunk chunk;
+  for (const auto& parser : parsers) chunk.add_column(parser->create_column());
+  return chunk;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size, size_t block_size) {
+  std::ifstream infile(file_name, std::ios::binary);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
 
   std::string line;
@@ -18,16 +152,57 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
   std::vector<std::string> col_names = _split<std::string>(line, '|');
   std::getline(infile, line);
   std::vector<std::string> col_types = _split<std::string>(line, '|');
+  Assert(col_names.size() == col_types.size(), "load_table: Every column needs a name and a type");
 
   std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
   for (size_t i = 0; i < col_names.size(); i++) {
-    test_table->add_column(col_names[i], col_types[i]);
+    test_table->add_column_definition(col_names[i], col_types[i]);
   }
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  const auto rows_per_chunk = chunk_size == 0 ? std::numeric_limits<size_t>::max() : chunk_size;
+
+  // The data that was read, but not parsed yet, always starts at the beginning of a line. Lines are only parsed once
+  // all rows of their chunk were read.
+  std::string buffer;
+  std::vector<size_t> line_ends;
+  auto loaded_chunk_count = size_t{0};
+
+  while (true) {
+    const auto read_begin = buffer.size();
+    buffer.resize(read_begin + block_size);
+    infile.read(buffer.data() + read_begin, block_size);
+    buffer.resize(read_begin + infile.gcount());
+    const auto at_end = !infile;
+
+    find_line_ends(buffer, read_begin, buffer.size(), line_ends);
+    // The last line does not need to end with a line break
+    if (at_end && buffer.size() > (line_ends.empty() ? 0 : line_ends.back() + 1)) line_ends.push_back(buffer.size());
+
+    auto chunk_count = line_ends.size() / rows_per_chunk;
+    if (at_end && line_ends.size() % rows_per_chunk != 0) ++chunk_count;
+
+    std::vector<Chunk> chunks(chunk_count);
+    for_each_in_parallel(chunk_count, [&](const size_t chunk_index) {
+      const auto first_line = chunk_index * rows_per_chunk;
+      const auto end_line = first_line + std::min(rows_per_chunk, line_ends.size() - first_line);
+      chunks[chunk_index] = parse_chunk(buffer, line_ends, first_line, end_line, col_types);
+    });
+    for (auto& chunk : chunks) test_table->emplace_chunk(std::move(chunk));
+    loaded_chunk_count += chunk_count;
+
+    if (at_end) break;
+    if (chunk_count == 0) continue;
+
+    const auto parsed_line_count = chunk_count * rows_per_chunk;
+    const auto parsed_size = line_ends[parsed_line_count - 1] + 1;
+    buffer.erase(0, parsed_size);
+    line_ends.erase(line_ends.begin(), line_ends.begin() + parsed_line_count);
+    for (auto& line_end : line_ends) line_end -= parsed_size;
   }
+
+  // A table without rows still needs the columns
+  if (loaded_chunk_count == 0) test_table->emplace_chunk(parse_chunk(buffer, line_ends, 0, 0, col_types));
+
   return test_table;
 }
 
@@ -22,7 +22,12 @@ std::vector<T> _split(const std::string& str, char delimiter) {
   return internal;
 }
 
-// This is a helper method which is heavily used in our test suite
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// Loads a table from a .tbl file, i.e., a file with the column names in the first line, the column types in the second
+// line, and one row per line after that, all separated by '|'. This is a helper method which is heavily used in our
+// test suite, but also meant for large files: these are read in blocks of the given size, and the rows of every chunk
+// are parsed into ValueColumns by a job on the CurrentScheduler. With an unlimited chunk size (0), all rows end up in
+// a single chunk and are thus parsed on one thread.
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  size_t block_size = size_t{64} * 1024 * 1024);
 
 }  // namespace opossum
@@ -0,0 +1,162 @@
+#include "plan_visualizer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_chunk_wise_operator.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+struct PlanEdge {
+  size_t from;
+  size_t to;
+  // nullopt if the input was executed as part of its consumer's pipeline
+  std::optional<uint64_t> row_count;
+};
+
+struct PlanGraph {
+  std::vector<std::shared_ptr<const AbstractOperator>> operators;
+  std::vector<PlanEdge> edges;
+};
+
+size_t add_operator(const std::shared_ptr<const AbstractOperator>& op, PlanGraph& graph,
+                    std::unordered_map<std::shared_ptr<const AbstractOperator>, size_t>& id_by_operator) {
+  const auto existing_id = id_by_operator.find(op);
+  if (existing_id != id_by_operator.end()) return existing_id->second;
+
+  const auto id = graph.operators.size();
+  graph.operators.push_back(op);
+  id_by_operator.emplace(op, id);
+
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input) continue;
+    const auto input_id = add_operator(input, graph, id_by_operator);
+
+    std::optional<uint64_t> row_count;
+    if (input->get_output()) row_count = input->performance_data().output_row_count;
+    graph.edges.push_back({input_id, id, row_count});
+  }
+  return id;
+}
+
+PlanGraph create_plan_graph(const std::shared_ptr<const AbstractOperator>& root) {
+  PlanGraph graph;
+  std::unordered_map<std::shared_ptr<const AbstractOperator>, size_t> id_by_operator;
+  add_operator(root, graph, id_by_operator);
+  return graph;
+}
+
+// An operator without output that is read by an executed chunk-wise operator was part of that one's pipeline
+bool is_pipelined(const PlanGraph& graph, const size_t id) {
+  if (graph.operators[id]->get_output()) return false;
+  return std::any_of(graph.edges.cbegin(), graph.edges.cend(), [&](const PlanEdge& edge) {
+    const auto& consumer = graph.operators[edge.to];
+    return edge.from == id && dynamic_cast<const AbstractChunkWiseOperator*>(consumer.get()) &&
+           (consumer->get_output() || is_pipelined(graph, edge.to));
+  });
+}
+
+std::string escape(const std::string& string) {
+  std::string escaped;
+  for (const auto character : string) {
+    if (character == '"' || character == '\\') escaped += '\\';
+    escaped += character;
+  }
+  return escaped;
+}
+
+double milliseconds(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+void PlanVisualizer::export_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  const auto graph = create_plan_graph(root);
+
+  auto max_walltime = std::chrono::nanoseconds{0};
+  for (const auto& op : graph.operators) max_walltime = std::max(max_walltime, op->performance_data().walltime);
+
+  // The graph is formatted separately so that the stream's formatting flags are not changed
+  std::ostringstream dot;
+  dot << std::fixed << std::setprecision(3);
+  dot << "digraph plan {\n";
+  dot << "  rankdir=BT;\n";
+  dot << "  node [shape=box, fontname=\"Helvetica\"];\n";
+  dot << "  edge [fontname=\"Helvetica\"];\n";
+
+  for (size_t id = 0; id < graph.operators.size(); ++id) {
+    const auto& op = *graph.operators[id];
+    const auto& data = op.performance_data();
+
+    dot << "  op" << id << " [label=\"" << escape(op.name()) << "\\n";
+    if (op.get_output()) {
+      // Boxes are between 1 and 4 inches wide
+      const auto share =
+          max_walltime.count() > 0 ? static_cast<double>(data.walltime.count()) / max_walltime.count() : 0.0;
+      dot << milliseconds(data.walltime) << " ms wall, " << milliseconds(data.cpu_time) << " ms CPU\\n"
+          << data.output_chunk_count << (data.output_chunk_count.t == 1 ? " chunk, " : " chunks, ")
+          << data.materialized_bytes << " bytes materialized\", width=" << 1.0 + 3.0 * share << "];\n";
+    } else if (is_pipelined(graph, id)) {
+      dot << "pipelined\", style=dashed];\n";
+    } else {
+      dot << "not executed\", style=dotted];\n";
+    }
+  }
+
+  for (const auto& edge : graph.edges) {
+    dot << "  op" << edge.from << " -> op" << edge.to;
+    if (edge.row_count) dot << " [label=\"" << *edge.row_count << " rows\"]";
+    dot << ";\n";
+  }
+
+  dot << "}\n";
+  out << dot.str();
+}
+
+void PlanVisualizer::export_json(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  const auto graph = create_plan_graph(root);
+
+  std::ostringstream json;
+  json << "{\"operators\": [";
+  for (size_t id = 0; id < graph.operators.size(); ++id) {
+    const auto& op = *graph.operators[id];
+    const auto& data = op.performance_data();
+
+    if (id > 0) json << ", ";
+    json << "{\"id\": " << id << ", \"name\": \"" << escape(op.name()) << "\", \"executed\": "
+         << (op.get_output() ? "true" : "false") << ", \"pipelined\": " << (is_pipelined(graph, id) ? "true" : "false")
+         << ", \"walltime_ns\": " << data.walltime.count() << ", \"cpu_time_ns\": " << data.cpu_time.count()
+         << ", \"input_rows\": " << data.input_row_count << ", \"output_rows\": " << data.output_row_count
+         << ", \"output_chunks\": " << data.output_chunk_count << ", \"materialized_bytes\": "
+         << data.materialized_bytes << "}";
+  }
+
+  json << "], \"edges\": [";
+  for (size_t index = 0; index < graph.edges.size(); ++index) {
+    const auto& edge = graph.edges[index];
+    if (index > 0) json << ", ";
+    json << "{\"from\": " << edge.from << ", \"to\": " << edge.to << ", \"rows\": ";
+    if (edge.row_count) {
+      json << *edge.row_count;
+    } else {
+      json << "null";
+    }
+    json << "}";
+  }
+  json << "]}\n";
+
+  out << json.str();
+}
+
+}  // namespace opossum
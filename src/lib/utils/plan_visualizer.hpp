@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Exports an operator DAG, i.e., an operator and everything it reads from via input_left() and input_right(), along
+// with the performance data of the executed operators (see AbstractOperator::performance_data).
+//
+// The DOT output can be rendered with Graphviz, e.g., `dot -Tsvg plan.dot > plan.svg`. Data flows from the bottom to
+// the top. Each operator is a box whose width grows with its share of the longest wall time in the plan, so that the
+// expensive operators stand out. Edges are labelled with the number of rows that pass along them.
+//
+// The JSON output contains the same information for further processing:
+//   {"operators": [{"id": 0, "name": "Sort", "executed": true, "walltime_ns": 1204000, "cpu_time_ns": 2317000,
+//                   "pipelined": false, "input_rows": 10, "output_rows": 5, "output_chunks": 1,
+//                   "materialized_bytes": 48}, ...],
+//    "edges": [{"from": 1, "to": 0, "rows": 10}, ...]}
+// Operators are numbered in the order of a depth-first traversal starting at the root. Edges from operators that were
+// executed as part of their consumer's pipeline have no row count ("rows": null), as their output was never
+// materialized.
+class PlanVisualizer {
+ public:
+  static void export_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out);
+  static void export_json(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out);
+};
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace opossum {
+
+// A read-only view of a contiguous array, e.g., of the values of a column that are either held in a std::vector or in a
+// memory-mapped file. This is a stand-in for std::span, which is only available with C++20.
+template <typename T>
+class Span {
+ public:
+  Span() = default;
+  Span(const T* data, const size_t size) : _data(data), _size(size) {}
+  Span(const std::vector<T>& values) : _data(values.data()), _size(values.size()) {}  // NOLINT(runtime/explicit)
+
+  const T* data() const { return _data; }
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const T& operator[](const size_t i) const { return _data[i]; }
+
+  const T* begin() const { return _data; }
+  const T* end() const { return _data + _size; }
+  const T* cbegin() const { return _data; }
+  const T* cend() const { return _data + _size; }
+
+ protected:
+  const T* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -6,6 +6,9 @@
 #include <utility>
 #include <vector>
 
+#include "operators/result_cache.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "storage/buffer_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -157,6 +160,15 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::reset();
+  ResultCache::reset();
+  BufferManager::reset();
+
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->finish();
+    CurrentScheduler::set(nullptr);
+  }
+}
 
 }  // namespace opossum
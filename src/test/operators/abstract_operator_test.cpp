@@ -0,0 +1,124 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAbstractOperatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (auto i = 0; i < 10; ++i) table->append({i, 10 * i});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAbstractOperatorTest, NotExecutedOperatorHasNoPerformanceData) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  EXPECT_EQ(scan->performance_data().walltime.count(), 0);
+  EXPECT_EQ(scan->performance_data().output_row_count, 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, RecordsPerformanceData) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan->execute();
+
+  const auto& scan_data = scan->performance_data();
+  EXPECT_GT(scan_data.walltime.count(), 0);
+  EXPECT_GT(scan_data.cpu_time.count(), 0);
+  EXPECT_EQ(scan_data.input_row_count, 10u);
+  EXPECT_EQ(scan_data.output_row_count, 5u);
+  EXPECT_EQ(scan_data.output_chunk_count, ChunkID{2});
+  // The output has a position list with 4 and one with 1 row
+  EXPECT_GE(scan_data.materialized_bytes, 5 * sizeof(RowID));
+
+  // Selected columns are passed through and not materialized
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+  EXPECT_EQ(projection->performance_data().input_row_count, 5u);
+  EXPECT_EQ(projection->performance_data().materialized_bytes, 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, DoesNotLoadEvictedColumnsForPerformanceData) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 10; ++i) table->append({i, 10 * i});
+  table->make_evictable("abstract_operator_test.");
+  auto& buffer_manager = BufferManager::get();
+  buffer_manager.set_memory_budget(0);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  EXPECT_EQ(table_wrapper->performance_data().materialized_bytes, 0u);
+  EXPECT_EQ(buffer_manager.load_count(), 0u);
+
+  auto limit = std::make_shared<Limit>(table_wrapper, 2);
+  limit->execute();
+  EXPECT_EQ(buffer_manager.load_count(), 0u);
+
+  // The scan loads the scanned column of each chunk, but nothing else
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan->execute();
+  EXPECT_EQ(buffer_manager.load_count(), 3u);
+  EXPECT_GT(scan->performance_data().materialized_bytes, 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, RecordsPerformanceDataOfTasks) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto sort = std::make_shared<Sort>(scan, ColumnID{1}, OrderByMode::Descending);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(sort));
+
+  EXPECT_EQ(scan->performance_data().output_row_count, 5u);
+  EXPECT_EQ(sort->performance_data().input_row_count, 5u);
+  EXPECT_EQ(sort->performance_data().output_row_count, 5u);
+  EXPECT_EQ(sort->performance_data().output_chunk_count, ChunkID{1});
+}
+
+TEST_F(OperatorsAbstractOperatorTest, PrintsPlan) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}});
+  auto sort = std::make_shared<Sort>(projection, ColumnID{0});
+  projection->execute();
+
+  std::ostringstream output;
+  sort->print(output);
+
+  std::vector<std::string> lines;
+  std::istringstream stream(output.str());
+  for (std::string line; std::getline(stream, line);) lines.push_back(line);
+
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_EQ(lines[0], "Sort: not executed");
+  EXPECT_EQ(lines[1].find("  Projection: "), 0u);
+  EXPECT_NE(lines[1].find(" ms wall, "), std::string::npos);
+  EXPECT_NE(lines[1].find("10 -> 5 rows, 2 chunks, "), std::string::npos);
+  EXPECT_EQ(lines[2], "    TableScan: executed in the pipeline of its consumer");
+  EXPECT_EQ(lines[3].find("      TableWrapper: "), 0u);
+}
+
+}  // namespace opossum
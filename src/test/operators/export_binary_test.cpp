@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsExportBinaryTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  // Writes the table to the file and reads it again
+  std::shared_ptr<const Table> _round_trip(const std::shared_ptr<const AbstractOperator>& input) {
+    auto export_binary = std::make_shared<ExportBinary>(input, _file_name);
+    export_binary->execute();
+    EXPECT_EQ(export_binary->get_output(), input->get_output());
+
+    auto import_binary = std::make_shared<ImportBinary>(_file_name);
+    import_binary->execute();
+    return import_binary->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<const Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  const std::string _file_name = "export_binary_test.bin";
+};
+
+TEST_F(OperatorsExportBinaryTest, AllTypes) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 2);
+  const auto result = _round_trip(_wrap(table));
+
+  EXPECT_TABLE_EQ(result, table, true);
+  EXPECT_EQ(result->chunk_count(), 3u);
+  EXPECT_EQ(result->chunk_size(), 2u);
+}
+
+TEST_F(OperatorsExportBinaryTest, DictionaryColumnsStayEncoded) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 2);
+  const auto compressed_table = load_table("src/test/tables/all_types.tbl", 2);
+  compressed_table->compress_chunk(ChunkID{0});
+  compressed_table->compress_chunk(ChunkID{2});
+
+  const auto result = _round_trip(_wrap(compressed_table));
+  EXPECT_TABLE_EQ(result, table, true);
+
+  const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      result->get_chunk(ChunkID{0}).get_column(ColumnID{4}));
+  ASSERT_TRUE(dictionary_column);
+  EXPECT_EQ(dictionary_column->unique_values_count(), 2u);
+  EXPECT_EQ(dictionary_column->attribute_vector()->width(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueColumn<int>>(result->get_chunk(ChunkID{1}).get_column(ColumnID{0})));
+}
+
+TEST_F(OperatorsExportBinaryTest, ReferenceColumnsAreMaterialized) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto scan = std::make_shared<TableScan>(_wrap(table), ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(_round_trip(scan), load_table("src/test/tables/int_float_filtered2.tbl", 1));
+}
+
+TEST_F(OperatorsExportBinaryTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  table->add_column_definition("b", "string");
+
+  const auto result = _round_trip(_wrap(table));
+  EXPECT_EQ(result->row_count(), 0u);
+  EXPECT_EQ(result->chunk_count(), 1u);
+  EXPECT_EQ(result->column_names(), table->column_names());
+}
+
+}  // namespace opossum
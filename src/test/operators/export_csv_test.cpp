@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_csv.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsExportCsvTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<const Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static std::string _to_csv(const Table& table) {
+    std::ostringstream out;
+    ExportCsv::write(table, out);
+    return out.str();
+  }
+
+  const std::string _file_name = "export_csv_test.csv";
+};
+
+TEST_F(OperatorsExportCsvTest, WritesFile) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 2);
+  table->compress_chunk(ChunkID{1});
+
+  auto export_csv = std::make_shared<ExportCsv>(_wrap(table), _file_name);
+  export_csv->execute();
+  EXPECT_EQ(export_csv->get_output(), table);
+
+  std::ifstream file(_file_name);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(contents.str(),
+            "a,b,c,d,e\n"
+            "1,10000000000,1.5,2.25,one\n"
+            "-2,-20,0,3,two words\n"
+            "3,30,-3.5,1000,\n"
+            "4,40,4.25,-0.5,four\n"
+            "5,50,5,5.125,five\n");
+}
+
+TEST_F(OperatorsExportCsvTest, QuotesStrings) {
+  auto table = std::make_shared<Table>();
+  table->add_column("name, first", "string");
+  table->add_column("quote", "string");
+  table->append({"a,b", "say \"hi\""});
+  table->append({"line\nbreak", "plain"});
+
+  EXPECT_EQ(_to_csv(*table),
+            "\"name, first\",quote\n"
+            "\"a,b\",\"say \"\"hi\"\"\"\n"
+            "\"line\nbreak\",plain\n");
+}
+
+TEST_F(OperatorsExportCsvTest, ReferenceColumns) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto scan = std::make_shared<TableScan>(_wrap(table), ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_EQ(_to_csv(*scan->get_output()), "a,b\n12345,458.7\n1234,457.7\n");
+}
+
+TEST_F(OperatorsExportCsvTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  EXPECT_EQ(_to_csv(*table), "a\n");
+}
+
+TEST_F(OperatorsExportCsvTest, FloatsRoundTrip) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "double");
+  table->add_column("b", "float");
+  table->append({0.1, 1.0f / 3});
+  EXPECT_EQ(_to_csv(*table), "a,b\n0.1,0.33333334\n");
+}
+
+}  // namespace opossum
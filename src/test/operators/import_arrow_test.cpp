@@ -0,0 +1,86 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/import_arrow.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportArrowTest : public BaseTest {};
+
+TEST_F(OperatorsImportArrowTest, FileFormat) {
+  auto import_arrow = std::make_shared<ImportArrow>("src/test/tables/all_types.arrow", "imported");
+  import_arrow->execute();
+  const auto table = import_arrow->get_output();
+
+  EXPECT_EQ(StorageManager::get().get_table("imported"), table);
+  EXPECT_TABLE_EQ(table, load_table("src/test/tables/all_types.tbl", 3), true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->chunk_size(), 3u);
+
+  // Numbers are read from the mapped file
+  const auto value_column =
+      std::dynamic_pointer_cast<const ValueColumn<int64_t>>(table->get_chunk(ChunkID{1}).get_column(ColumnID{1}));
+  ASSERT_TRUE(value_column);
+  EXPECT_TRUE(value_column->has_external_values());
+}
+
+TEST_F(OperatorsImportArrowTest, StreamFormatWithDictionaries) {
+  auto import_arrow = std::make_shared<ImportArrow>("src/test/tables/dictionary.arrows");
+  import_arrow->execute();
+  const auto table = import_arrow->get_output();
+
+  EXPECT_EQ(table->column_types(), (std::vector<std::string>{"string", "int", "long", "string"}));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("name", "string");
+  expected->add_column("small", "int");
+  expected->add_column("unsigned", "long");
+  expected->add_column("large", "string");
+  expected->append({"pear", 1, int64_t{1}, "w"});
+  expected->append({"apple", -2, int64_t{2}, "x"});
+  expected->append({"pear", 3, int64_t{4000000000}, "y"});
+  expected->append({"fig", 4, int64_t{3}, "z"});
+  expected->append({"fig", 5, int64_t{5}, "u"});
+  expected->append({"fig", 6, int64_t{6}, "v"});
+  EXPECT_TABLE_EQ(table, expected, true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+
+  // The dictionary is sorted and shared by the chunks
+  const auto first_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  const auto second_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+  ASSERT_TRUE(first_column && second_column);
+  EXPECT_EQ(*first_column->dictionary(), (std::vector<std::string>{"apple", "fig", "pear"}));
+  EXPECT_EQ(first_column->dictionary(), second_column->dictionary());
+  EXPECT_EQ(first_column->attribute_vector()->get(0), ValueID{2});
+}
+
+TEST_F(OperatorsImportArrowTest, EmptyRecordBatch) {
+  // The first record batch has no rows and its string columns have empty offset buffers
+  auto import_arrow = std::make_shared<ImportArrow>("src/test/tables/empty_strings.arrow");
+  import_arrow->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("name", "string");
+  expected->add_column("large", "string");
+  expected->add_column("value", "int");
+  expected->append({"a", "x", 1});
+  expected->append({"bc", "", 2});
+  EXPECT_TABLE_EQ(import_arrow->get_output(), expected, true);
+}
+
+TEST_F(OperatorsImportArrowTest, OtherFilesAreRejected) {
+  EXPECT_THROW(std::make_shared<ImportArrow>("src/test/tables/int_float.tbl")->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = "import_binary_test.bin";
+};
+
+TEST_F(OperatorsImportBinaryTest, AddsTableToStorageManager) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  std::make_shared<ExportBinary>(table_wrapper, _file_name)->execute();
+
+  auto import_binary = std::make_shared<ImportBinary>(_file_name, "imported");
+  import_binary->execute();
+
+  EXPECT_EQ(StorageManager::get().get_table("imported"), import_binary->get_output());
+  EXPECT_TABLE_EQ(import_binary->get_output(), table, true);
+}
+
+TEST_F(OperatorsImportBinaryTest, MapsFile) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 2);
+  table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  std::make_shared<ExportBinary>(table_wrapper, _file_name)->execute();
+
+  auto import_binary = std::make_shared<ImportBinary>(_file_name, std::nullopt, ImportMode::Map);
+  import_binary->execute();
+  const auto mapped_table = import_binary->get_output();
+  EXPECT_TABLE_EQ(mapped_table, table, true);
+
+  // Numbers and value ids are read from the file, strings are copied
+  const auto& chunk = mapped_table->get_chunk(ChunkID{0});
+  const auto long_column = std::dynamic_pointer_cast<ValueColumn<int64_t>>(chunk.get_column(ColumnID{1}));
+  ASSERT_TRUE(long_column);
+  EXPECT_TRUE(long_column->has_external_values());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(long_column->values().data()) % alignof(int64_t), 0u);
+  const auto string_column = std::dynamic_pointer_cast<ValueColumn<std::string>>(chunk.get_column(ColumnID{4}));
+  ASSERT_TRUE(string_column);
+  EXPECT_FALSE(string_column->has_external_values());
+
+  const auto dictionary_column = std::dynamic_pointer_cast<DictionaryColumn<double>>(
+      mapped_table->get_chunk(ChunkID{1}).get_column(ColumnID{3}));
+  ASSERT_TRUE(dictionary_column);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FittedAttributeVector<uint8_t>>(dictionary_column->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->value_ids().size(), 2u);
+
+  // The file stays mapped as long as the table exists, and the last chunk can still be appended to
+  import_binary = nullptr;
+  std::const_pointer_cast<Table>(mapped_table)->append({6, int64_t{60}, 6.0f, 6.5, "six"});
+  EXPECT_EQ(mapped_table->row_count(), 6u);
+  EXPECT_EQ(mapped_table->get_chunk(ChunkID{2}).get_column(ColumnID{1})->operator[](0), AllTypeVariant{int64_t{50}});
+}
+
+TEST_F(OperatorsImportBinaryTest, InvalidFiles) {
+  EXPECT_THROW(std::make_shared<ImportBinary>("does_not_exist.bin")->execute(), std::exception);
+
+  // A .tbl file is not a binary table file
+  EXPECT_THROW(std::make_shared<ImportBinary>("src/test/tables/int_float.tbl")->execute(), std::exception);
+
+  // Truncated file
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  std::make_shared<ExportBinary>(table_wrapper, _file_name)->execute();
+  std::string content;
+  {
+    std::ifstream in(_file_name, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  std::ofstream(_file_name, std::ios::binary) << content.substr(0, content.size() - 3);
+  EXPECT_THROW(std::make_shared<ImportBinary>(_file_name)->execute(), std::exception);
+  EXPECT_THROW(std::make_shared<ImportBinary>(_file_name, std::nullopt, ImportMode::Map)->execute(), std::exception);
+}
+
+}  // namespace opossum
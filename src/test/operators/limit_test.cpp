@@ -0,0 +1,170 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto i = 0; i < 20; ++i) _table->append({i, std::to_string(i)});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, FirstRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 3);
+  limit->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({0, "0"});
+  expected->append({1, "1"});
+  expected->append({2, "2"});
+
+  EXPECT_TABLE_EQ(limit->get_output(), expected, true);
+  EXPECT_EQ(limit->get_output()->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsLimitTest, ZeroRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+
+  EXPECT_EQ(limit->get_output()->row_count(), 0u);
+  EXPECT_EQ(limit->get_output()->get_chunk(ChunkID{0}).col_count(), 2u);
+}
+
+TEST_F(OperatorsLimitTest, ZeroRowsOfReferenceTable) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  auto limit = std::make_shared<Limit>(scan, 0);
+  scan->execute();
+  limit->execute();
+
+  // The empty output references the original table rather than the scan's output
+  const auto& chunk = limit->get_output()->get_chunk(ChunkID{0});
+  ASSERT_EQ(chunk.col_count(), 2u);
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+    ASSERT_TRUE(column);
+    EXPECT_EQ(column->referenced_table(), _table);
+    EXPECT_EQ(column->referenced_column_id(), column_id);
+    EXPECT_EQ(column->size(), 0u);
+  }
+}
+
+TEST_F(OperatorsLimitTest, MoreRowsThanInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 100);
+  limit->execute();
+
+  EXPECT_TABLE_EQ(limit->get_output(), _table, true);
+}
+
+TEST_F(OperatorsLimitTest, ScanStopsEarly) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  auto limit = std::make_shared<Limit>(scan, 3);
+  scan->execute();
+  limit->execute();
+
+  EXPECT_EQ(limit->get_output()->row_count(), 3u);
+  EXPECT_EQ(limit->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0})->operator[](0), AllTypeVariant{4});
+
+  // The scan has only looked at the chunks with the rows 4 to 7
+  EXPECT_EQ(scan->get_output()->row_count(), 4u);
+}
+
+TEST_F(OperatorsLimitTest, SharedScanDoesNotStopEarly) {
+  // The scan's output is read entirely by the UnionAll, so the Limit must not make the scan stop early
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  auto limit = std::make_shared<Limit>(scan, 3);
+  auto union_all = std::make_shared<UnionAll>(scan, limit);
+  EXPECT_EQ(scan->row_limit_hint(), std::nullopt);
+
+  scan->execute();
+  limit->execute();
+  union_all->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 16u);
+  EXPECT_EQ(limit->get_output()->row_count(), 3u);
+  EXPECT_EQ(union_all->get_output()->row_count(), 19u);
+}
+
+TEST_F(OperatorsLimitTest, LimitsOfDifferentSizesOnSharedScan) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  auto large_limit = std::make_shared<Limit>(scan, 10);
+  EXPECT_EQ(scan->row_limit_hint(), 10u);
+
+  {
+    // A second consumer removes the hint until it is destroyed
+    auto small_limit = std::make_shared<Limit>(scan, 2);
+    EXPECT_EQ(scan->row_limit_hint(), std::nullopt);
+  }
+  EXPECT_EQ(scan->row_limit_hint(), 10u);
+
+  auto small_limit = std::make_shared<Limit>(scan, 2);
+  scan->execute();
+  large_limit->execute();
+  small_limit->execute();
+  EXPECT_EQ(large_limit->get_output()->row_count(), 10u);
+  EXPECT_EQ(small_limit->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsLimitTest, ScanWithoutLimitScansEverything) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 16u);
+}
+
+TEST_F(OperatorsLimitTest, SortOnlySortsTopRows) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Descending);
+  auto limit = std::make_shared<Limit>(sort, 2);
+  sort->execute();
+  limit->execute();
+
+  EXPECT_EQ(sort->get_output()->row_count(), 2u);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({19, "19"});
+  expected->append({18, "18"});
+  EXPECT_TABLE_EQ(limit->get_output(), expected, true);
+}
+
+TEST_F(OperatorsLimitTest, ParallelScanStopsEarly) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(2));
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  auto limit = std::make_shared<Limit>(scan, 3);
+  scan->execute();
+  limit->execute();
+
+  // The scan works in batches of chunks, but does not emit more chunks than needed
+  EXPECT_EQ(scan->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(limit->get_output()->row_count(), 3u);
+}
+
+}  // namespace opossum
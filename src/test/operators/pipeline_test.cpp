@@ -0,0 +1,191 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/projection_expression.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Tests chunk-wise operators that are executed together as a pipeline, see AbstractChunkWiseOperator
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (auto i = 0; i < 10; ++i) _table->append({i, 10 * i});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // a > 1 -> (a, a + b AS sum) -> sum < 70 -> (sum)
+  std::shared_ptr<Projection> _make_plan() {
+    auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+    const auto sum = ProjectionExpression::create_binary_operator(
+        ExpressionType::Addition, ProjectionExpression::create_column(ColumnID{0}),
+        ProjectionExpression::create_column(ColumnID{1}), std::string{"sum"});
+    auto first_projection = std::make_shared<Projection>(
+        first_scan, std::vector<std::shared_ptr<ProjectionExpression>>{ProjectionExpression::create_column(ColumnID{0}),
+                                                                       sum});
+    auto second_scan = std::make_shared<TableScan>(first_projection, ColumnID{1}, ScanType::OpLessThan, 70);
+    return std::make_shared<Projection>(second_scan, std::vector<ColumnID>{ColumnID{1}});
+  }
+
+  std::shared_ptr<Table> _expected_sums(const std::vector<int>& sums) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("sum", "int");
+    for (const auto sum : sums) expected->append({sum});
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, PassesChunksThroughAllOperators) {
+  auto plan = _make_plan();
+  plan->execute();
+
+  EXPECT_TABLE_EQ(plan->get_output(), _expected_sums({22, 33, 44, 55, 66}), true);
+
+  // Only the topmost operator materializes its output
+  for (auto input = plan->input_left(); input != _table_wrapper; input = input->input_left()) {
+    EXPECT_EQ(input->get_output(), nullptr);
+  }
+
+  // Every source chunk with rows left produces one output chunk, in the order of the source. The filtered values of the
+  // computed column are copied, as there is no intermediate table to reference.
+  const auto& output = *plan->get_output();
+  EXPECT_EQ(output.chunk_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<int>>(output.get_chunk(chunk_id).get_column(ColumnID{0})));
+  }
+}
+
+TEST_F(OperatorsPipelineTest, ProducesSameResultAsOperatorByOperatorExecution) {
+  auto pipelined_plan = _make_plan();
+  pipelined_plan->execute();
+
+  auto plan = _make_plan();
+  auto input = plan->input_left();
+  std::vector<std::shared_ptr<AbstractOperator>> operators;
+  for (; input != _table_wrapper; input = input->input_left()) {
+    operators.insert(operators.begin(), std::const_pointer_cast<AbstractOperator>(input));
+  }
+  for (const auto& op : operators) op->execute();
+  plan->execute();
+
+  EXPECT_TABLE_EQ(pipelined_plan->get_output(), plan->get_output(), true);
+}
+
+TEST_F(OperatorsPipelineTest, ReferencesSourceTable) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, 50);
+  second_scan->execute();
+
+  const auto& output = *second_scan->get_output();
+  EXPECT_EQ(output.row_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<ReferenceColumn>(output.get_chunk(chunk_id).get_column(ColumnID{0}));
+    ASSERT_TRUE(column);
+    EXPECT_EQ(column->referenced_table(), _table);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, ReferencesSourceColumnsPassedThroughProjection) {
+  // (b, a + b AS sum) -> b < 50. The values of b are not copied, but referenced in the source table.
+  const auto sum = ProjectionExpression::create_binary_operator(
+      ExpressionType::Addition, ProjectionExpression::create_column(ColumnID{0}),
+      ProjectionExpression::create_column(ColumnID{1}), std::string("sum"));
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper,
+      std::vector<std::shared_ptr<ProjectionExpression>>{ProjectionExpression::create_column(ColumnID{1}), sum});
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{0}, ScanType::OpLessThan, 50);
+  scan->execute();
+  EXPECT_EQ(projection->get_output(), nullptr);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "int");
+  expected->add_column("sum", "int");
+  for (auto i = 0; i < 5; ++i) expected->append({10 * i, 11 * i});
+  EXPECT_TABLE_EQ(scan->get_output(), expected, true);
+
+  const auto& output = *scan->get_output();
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    const auto b = std::dynamic_pointer_cast<ReferenceColumn>(chunk.get_column(ColumnID{0}));
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->referenced_table(), _table);
+    EXPECT_EQ(b->referenced_column_id(), ColumnID{1});
+    EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{1})));
+  }
+}
+
+TEST_F(OperatorsPipelineTest, EmptyOutputHasColumns) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, 0);
+  second_scan->execute();
+
+  EXPECT_EQ(second_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(second_scan->get_output()->get_chunk(ChunkID{0}).col_count(), 2u);
+}
+
+TEST_F(OperatorsPipelineTest, StopsAtRowLimitHint) {
+  auto plan = _make_plan();
+  auto limit = std::make_shared<Limit>(plan, 2);
+  plan->execute();
+  limit->execute();
+
+  EXPECT_TABLE_EQ(limit->get_output(), _expected_sums({22, 33}), true);
+}
+
+TEST_F(OperatorsPipelineTest, BreaksAtSort) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  auto plan = _make_plan();
+  auto sort = std::make_shared<Sort>(plan, ColumnID{0}, OrderByMode::Descending);
+  auto scan_of_sort = std::make_shared<TableScan>(sort, ColumnID{0}, ScanType::OpGreaterThan, 30);
+
+  // The chunk-wise operators below the Sort are executed by the task of the topmost one
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan_of_sort);
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(tasks[0]->get_operator(), plan);
+  EXPECT_EQ(tasks[1]->get_operator(), sort);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_TABLE_EQ(scan_of_sort->get_output(), _expected_sums({66, 55, 44, 33}), true);
+}
+
+TEST_F(OperatorsPipelineTest, OperatorsWithSeveralConsumersAreNotPipelined) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto left_projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{0}});
+  auto right_projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}});
+  auto union_all = std::make_shared<UnionAll>(left_projection, right_projection);
+
+  // The scan is read by both projections, so its output has to be materialized
+  const auto tasks = OperatorTask::make_tasks_from_operator(union_all);
+  ASSERT_EQ(tasks.size(), 4u);
+  EXPECT_EQ(tasks.front()->get_operator(), scan);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(union_all->get_output()->row_count(), 16u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,270 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/projection_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+    _table->add_column("c", "string");
+    for (auto i = 0; i < 6; ++i) _table->append({i, i * 1.5f, std::to_string(i)});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<ProjectionExpression> column(const ColumnID::base_type column_id) {
+    return ProjectionExpression::create_column(ColumnID{column_id});
+  }
+
+  static std::shared_ptr<ProjectionExpression> literal(const AllTypeVariant& value) {
+    return ProjectionExpression::create_literal(value);
+  }
+
+  static std::shared_ptr<ProjectionExpression> op(const ExpressionType type,
+                                                  const std::shared_ptr<ProjectionExpression>& left,
+                                                  const std::shared_ptr<ProjectionExpression>& right) {
+    return ProjectionExpression::create_binary_operator(type, left, right);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, SelectsAndReordersColumns) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("c", "string");
+  expected->add_column("a", "int");
+  for (auto i = 0; i < 6; ++i) expected->append({std::to_string(i), i});
+
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+  EXPECT_EQ(projection->get_output()->chunk_count(), 3u);
+}
+
+TEST_F(OperatorsProjectionTest, PassesValueAndDictionaryColumnsThrough) {
+  _table->compress_chunk(ChunkID{1});
+
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+
+  const auto& output = *projection->get_output();
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output.get_chunk(chunk_id).get_column(ColumnID{0}), _table->get_chunk(chunk_id).get_column(ColumnID{1}));
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionaryColumn<float>>(output.get_chunk(ChunkID{1}).get_column(ColumnID{0})));
+}
+
+TEST_F(OperatorsProjectionTest, PassesReferenceColumnsThrough) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan->execute();
+
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{2}});
+  projection->execute();
+
+  const auto& scan_output = *scan->get_output();
+  const auto& output = *projection->get_output();
+  ASSERT_EQ(output.chunk_count(), scan_output.chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto column = output.get_chunk(chunk_id).get_column(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceColumn>(column));
+    EXPECT_EQ(column, scan_output.get_chunk(chunk_id).get_column(ColumnID{2}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsRowLimitHint) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{0}});
+  auto limit = std::make_shared<Limit>(projection, 1);
+  scan->execute();
+  projection->execute();
+  limit->execute();
+
+  EXPECT_EQ(scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(limit->get_output()->row_count(), 1u);
+}
+
+TEST_F(OperatorsProjectionTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  table->add_column_definition("b", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto projection = std::make_shared<Projection>(table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+
+  EXPECT_EQ(projection->get_output()->col_count(), 1u);
+  EXPECT_EQ(projection->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsProjectionTest, ComputesArithmeticExpressions) {
+  // a * b + a, and a % 4
+  const auto a_times_b_plus_a =
+      op(ExpressionType::Addition, op(ExpressionType::Multiplication, column(0), column(1)), column(0));
+  const auto a_modulo_4 = op(ExpressionType::Modulo, column(0), literal(4));
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{a_times_b_plus_a, a_modulo_4});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("(a * b) + a", "float");
+  expected->add_column("a % 4", "int");
+  for (auto i = 0; i < 6; ++i) expected->append({i * (i * 1.5f) + i, i % 4});
+
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+  EXPECT_EQ(projection->get_output()->chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<float>>(
+      projection->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0})));
+}
+
+TEST_F(OperatorsProjectionTest, PromotesTypes) {
+  const auto& table = *_table;
+  EXPECT_EQ(op(ExpressionType::Addition, column(0), literal(int64_t{1}))->data_type(table), "long");
+  EXPECT_EQ(op(ExpressionType::Addition, literal(int64_t{1}), column(1))->data_type(table), "float");
+  EXPECT_EQ(op(ExpressionType::Division, column(1), literal(2.0))->data_type(table), "double");
+  EXPECT_EQ(op(ExpressionType::Subtraction, column(0), column(0))->data_type(table), "int");
+  EXPECT_THROW(op(ExpressionType::Addition, column(0), column(2))->data_type(table), std::logic_error);
+
+  // The division is computed on ints before its result is converted for the addition
+  const auto expression =
+      op(ExpressionType::Addition, op(ExpressionType::Division, column(0), literal(4)), literal(0.5));
+  auto projection =
+      std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{expression});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("(a / 4) + 0.5", "double");
+  for (auto i = 0; i < 6; ++i) expected->append({i / 4 + 0.5});
+
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, ComputesLiteralsAndAliases) {
+  const auto expressions = std::vector<std::shared_ptr<ProjectionExpression>>{
+      ProjectionExpression::create_literal(std::string{"x"}, std::string{"constant"}),
+      ProjectionExpression::create_binary_operator(ExpressionType::Multiplication, literal(2), literal(3),
+                                                   std::string{"six"}),
+      ProjectionExpression::create_column(ColumnID{0}, std::string{"id"})};
+  auto projection = std::make_shared<Projection>(_table_wrapper, expressions);
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("constant", "string");
+  expected->add_column("six", "int");
+  expected->add_column("id", "int");
+  for (auto i = 0; i < 6; ++i) expected->append({"x", 6, i});
+
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, ComputesOnDictionaryAndReferenceColumns) {
+  _table->compress_chunk(ChunkID{0});
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 2);
+  scan->execute();
+
+  const auto a_plus_b = op(ExpressionType::Addition, column(0), column(1));
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector<std::shared_ptr<ProjectionExpression>>{column(2), a_plus_b});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("c", "string");
+  expected->add_column("a + b", "float");
+  for (auto i = 0; i < 6; ++i) {
+    if (i != 2) expected->append({std::to_string(i), i + i * 1.5f});
+  }
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+
+  // The output mixes ReferenceColumns and ValueColumns, which a following scan has to handle
+  auto second_scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpGreaterThan, 5.0f);
+  second_scan->execute();
+
+  auto expected_scan = std::make_shared<Table>();
+  expected_scan->add_column("c", "string");
+  expected_scan->add_column("a + b", "float");
+  for (auto i = 3; i < 6; ++i) expected_scan->append({std::to_string(i), i + i * 1.5f});
+  EXPECT_TABLE_EQ(second_scan->get_output(), expected_scan, true);
+}
+
+TEST_F(OperatorsProjectionTest, IntegerDivisionByZeroThrows) {
+  const auto expression =
+      op(ExpressionType::Division, column(0), op(ExpressionType::Subtraction, column(0), column(0)));
+  auto projection =
+      std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{expression});
+  EXPECT_THROW(projection->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsProjectionTest, IntegerOverflowThrows) {
+  auto table = std::make_shared<Table>();
+  table->add_column("i", "int");
+  table->add_column("l", "long");
+  table->append({std::numeric_limits<int32_t>::min(), std::numeric_limits<int64_t>::max()});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto execute = [&](const std::shared_ptr<ProjectionExpression>& expression) {
+    auto projection =
+        std::make_shared<Projection>(table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{expression});
+    projection->execute();
+    return projection->get_output();
+  };
+
+  EXPECT_THROW(execute(op(ExpressionType::Division, column(0), literal(-1))), std::logic_error);
+  EXPECT_THROW(execute(op(ExpressionType::Modulo, column(0), literal(-1))), std::logic_error);
+  EXPECT_THROW(execute(op(ExpressionType::Subtraction, column(0), literal(1))), std::logic_error);
+  EXPECT_THROW(execute(op(ExpressionType::Multiplication, column(0), literal(-1))), std::logic_error);
+  EXPECT_THROW(execute(op(ExpressionType::Addition, column(1), literal(1))), std::logic_error);
+  EXPECT_THROW(execute(op(ExpressionType::Multiplication, literal(2), column(1))), std::logic_error);
+
+  // The operation is computed in the wider type of its operands, in which it does not overflow
+  auto output = execute(op(ExpressionType::Division, column(0), literal(int64_t{-1})));
+  EXPECT_EQ(output->column_type(ColumnID{0}), "long");
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{0})->operator[](0),
+            AllTypeVariant{-int64_t{std::numeric_limits<int32_t>::min()}});
+
+  output = execute(op(ExpressionType::Division, column(1), literal(-1)));
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).get_column(ColumnID{0})->operator[](0),
+            AllTypeVariant{-std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(OperatorsProjectionTest, ComputesInParallel) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  const auto a_times_a = op(ExpressionType::Multiplication, column(0), column(0));
+  auto projection =
+      std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{a_times_a});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a * a", "int");
+  for (auto i = 0; i < 6; ++i) expected->append({i * i});
+
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+  EXPECT_EQ(projection->get_output()->chunk_count(), 3u);
+}
+
+}  // namespace opossum
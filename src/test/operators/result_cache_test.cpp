@@ -0,0 +1,146 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/print.hpp"
+#include "operators/projection.hpp"
+#include "operators/result_cache.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto i = 0; i < 5; ++i) _table->append({i, std::to_string(i)});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  static std::shared_ptr<TableScan> _make_scan(const AllTypeVariant& search_value) {
+    auto get_table = std::make_shared<GetTable>("table");
+    return std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, search_value);
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractOperator>& op) {
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(op));
+    return op->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsResultCacheTest, IsDisabledByDefault) {
+  const auto output = _execute(_make_scan(3));
+  EXPECT_NE(_execute(_make_scan(3)), output);
+  EXPECT_EQ(ResultCache::get().size(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, ReusesOutputOfEqualPlans) {
+  ResultCache::get().set_capacity(10);
+
+  const auto output = _execute(_make_scan(3));
+  EXPECT_EQ(output->row_count(), 3u);
+
+  auto scan = _make_scan(3);
+  EXPECT_EQ(_execute(scan), output);
+  EXPECT_TRUE(scan->performance_data().is_cached);
+
+  // The GetTable below the cached scan was not needed
+  EXPECT_EQ(scan->input_left()->get_output(), nullptr);
+  EXPECT_EQ(ResultCache::get().hit_count(), 1u);
+}
+
+TEST_F(OperatorsResultCacheTest, ReusesOutputWithScheduler) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(2));
+  ResultCache::get().set_capacity(10);
+
+  const auto output = _execute(_make_scan(3));
+  auto scan = _make_scan(3);
+  EXPECT_TRUE(OperatorTask::make_tasks_from_operator(scan).empty());
+  EXPECT_EQ(scan->get_output(), output);
+}
+
+TEST_F(OperatorsResultCacheTest, DistinguishesParameters) {
+  ResultCache::get().set_capacity(10);
+
+  const auto output = _execute(_make_scan(3));
+  EXPECT_NE(_execute(_make_scan(4)), output);
+  EXPECT_NE(_execute(_make_scan(3.0f)), output);
+
+  auto get_table = std::make_shared<GetTable>("table");
+  EXPECT_NE(_execute(std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThanEquals, 3)), output);
+
+  auto limited_scan = _make_scan(3);
+  limited_scan->set_row_limit_hint(1);
+  EXPECT_NE(_execute(limited_scan), output);
+}
+
+TEST_F(OperatorsResultCacheTest, InvalidatesOnTableChanges) {
+  ResultCache::get().set_capacity(10);
+
+  const auto output = _execute(_make_scan(3));
+  _table->append({0, "0"});
+
+  const auto new_output = _execute(_make_scan(3));
+  EXPECT_NE(new_output, output);
+  EXPECT_EQ(new_output->row_count(), 4u);
+
+  // A different table under the same name is not mistaken for the old one
+  auto replacement = std::make_shared<Table>();
+  replacement->add_column("a", "int");
+  StorageManager::get().add_table("table", replacement);
+  EXPECT_EQ(_execute(_make_scan(3))->row_count(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, SupportsFingerprints) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto expression = ProjectionExpression::create_binary_operator(
+      ExpressionType::Addition, ProjectionExpression::create_column(ColumnID{0}),
+      ProjectionExpression::create_literal(1), std::string{"a + 1"});
+  auto projection =
+      std::make_shared<Projection>(table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{expression});
+  EXPECT_TRUE(projection->fingerprint());
+  EXPECT_EQ(projection->fingerprint(),
+            std::make_shared<Projection>(table_wrapper, std::vector<std::shared_ptr<ProjectionExpression>>{expression})
+                ->fingerprint());
+
+  // Operators with side effects are never cached
+  EXPECT_FALSE(std::make_shared<Print>(projection)->fingerprint());
+
+  // Without the table, GetTable has nothing to cache
+  EXPECT_FALSE(std::make_shared<GetTable>("missing")->fingerprint());
+}
+
+TEST_F(OperatorsResultCacheTest, EvictsLeastRecentlyUsedOutput) {
+  auto& cache = ResultCache::get();
+  cache.set_capacity(2);
+
+  cache.set("first", _table);
+  cache.set("second", _table);
+  EXPECT_EQ(cache.try_get("first"), _table);
+  cache.set("third", _table);
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.try_get("second"), nullptr);
+  EXPECT_EQ(cache.try_get("first"), _table);
+  EXPECT_EQ(cache.try_get("third"), _table);
+
+  cache.set_capacity(0);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.try_get("first"), nullptr);
+}
+
+}  // namespace opossum
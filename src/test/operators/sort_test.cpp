@@ -0,0 +1,194 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    table->add_column("c", "string");
+    table->append({3, 1.5f, "x"});
+    table->append({1, 2.5f, "y"});
+    table->append({2, 1.5f, "z"});
+    table->append({5, 0.5f, "x"});
+    table->append({4, 2.5f, "y"});
+    table->append({1, 0.5f, "z"});
+    table->append({2, 3.5f, "x"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    table->add_column("c", "string");
+    for (const auto& row : rows) table->append(row);
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, AscendingSingleColumn) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0});
+  sort->execute();
+
+  auto expected = _expected_table({{1, 2.5f, "y"},
+                                   {1, 0.5f, "z"},
+                                   {2, 1.5f, "z"},
+                                   {2, 3.5f, "x"},
+                                   {3, 1.5f, "x"},
+                                   {4, 2.5f, "y"},
+                                   {5, 0.5f, "x"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, DescendingSingleColumn) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{2}, OrderByMode::Descending);
+  sort->execute();
+
+  auto expected = _expected_table({{2, 1.5f, "z"},
+                                   {1, 0.5f, "z"},
+                                   {1, 2.5f, "y"},
+                                   {4, 2.5f, "y"},
+                                   {3, 1.5f, "x"},
+                                   {5, 0.5f, "x"},
+                                   {2, 3.5f, "x"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending},
+                                                        {ColumnID{0}, OrderByMode::Ascending}});
+  sort->execute();
+
+  auto expected = _expected_table({{2, 3.5f, "x"},
+                                   {1, 2.5f, "y"},
+                                   {4, 2.5f, "y"},
+                                   {2, 1.5f, "z"},
+                                   {3, 1.5f, "x"},
+                                   {1, 0.5f, "z"},
+                                   {5, 0.5f, "x"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, TopN) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 3);
+  sort->execute();
+
+  auto expected = _expected_table({{5, 0.5f, "x"}, {4, 2.5f, "y"}, {3, 1.5f, "x"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, LimitLargerThanInput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 100);
+  sort->execute();
+
+  EXPECT_EQ(sort->get_output()->row_count(), 7u);
+}
+
+TEST_F(OperatorsSortTest, OutputReferencesInput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0});
+  sort->execute();
+
+  const auto& chunk = sort->get_output()->get_chunk(ChunkID{0});
+  ASSERT_EQ(chunk.col_count(), 3u);
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    auto reference_column = std::dynamic_pointer_cast<ReferenceColumn>(chunk.get_column(column_id));
+    ASSERT_NE(reference_column, nullptr);
+    EXPECT_EQ(reference_column->referenced_table(), _table_wrapper->get_output());
+  }
+}
+
+TEST_F(OperatorsSortTest, SortReferencedTable) {
+  auto sort_1 = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 4);
+  sort_1->execute();
+
+  auto sort_2 = std::make_shared<Sort>(sort_1, ColumnID{1});
+  sort_2->execute();
+
+  auto expected = _expected_table({{1, 0.5f, "z"}, {2, 1.5f, "z"}, {1, 2.5f, "y"}, {2, 3.5f, "x"}});
+  EXPECT_TABLE_EQ(sort_2->get_output(), expected, true);
+
+  // References are resolved, i.e., the second sort references the original table as well
+  auto reference_column =
+      std::dynamic_pointer_cast<ReferenceColumn>(sort_2->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  EXPECT_EQ(reference_column->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsSortTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  sort->execute();
+
+  EXPECT_EQ(sort->get_output()->row_count(), 0u);
+  EXPECT_EQ(sort->get_output()->col_count(), 1u);
+}
+
+TEST_F(OperatorsSortTest, SortInParallel) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 500; ++i) table->append({(i * 37) % 500});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Descending);
+  sort->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (auto i = 499; i >= 0; --i) expected->append({i});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, SortEvictableTable) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 500; ++i) table->append({(i * 37) % 500});
+  table->make_evictable("sort_test.");
+  auto& buffer_manager = BufferManager::get();
+  buffer_manager.set_memory_budget(0);
+  const auto eviction_count = buffer_manager.eviction_count();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  sort->execute();
+
+  // The sort uses the columns in place, so they must not be evicted while it runs
+  EXPECT_EQ(buffer_manager.load_count(), 50u);
+  EXPECT_EQ(buffer_manager.eviction_count(), eviction_count);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (auto i = 0; i < 500; ++i) expected->append({i});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+}  // namespace opossum
@@ -1,9 +1,13 @@
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -13,6 +17,9 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -20,251 +27,335 @@
 
 namespace opossum {
 
-// class OperatorsTableScanTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
-//     _table_wrapper->execute();
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
 
-//     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-//     test_even_dict->add_column("a", "int");
-//     test_even_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
+    std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
+    test_even_dict->add_column("a", "int");
+    test_even_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
 
-//     test_even_dict->compress_chunk(ChunkID(0));
-//     test_even_dict->compress_chunk(ChunkID(1));
+    test_even_dict->compress_chunk(ChunkID(0));
+    test_even_dict->compress_chunk(ChunkID(1));
 
-//     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
-//     _table_wrapper_even_dict->execute();
-//   }
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
+    _table_wrapper_even_dict->execute();
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
-//     auto table = std::make_shared<Table>(5);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_part_dict() {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 1; i < 20; ++i) {
-//       table->append({i, 100.1 + i});
-//     }
+    for (int i = 1; i < 20; ++i) {
+      table->append({i, 100.1 + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-//     table->compress_chunk(ChunkID(1));
+    table->compress_chunk(ChunkID(0));
+    table->compress_chunk(ChunkID(1));
 
-//     auto table_wrapper = std::make_shared<TableWrapper>(table);
-//     table_wrapper->execute();
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
 
-//     return table_wrapper;
-//   }
+    return table_wrapper;
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
-//     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
-//     auto table = std::make_shared<opossum::Table>(0);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
+    // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
+    auto table = std::make_shared<opossum::Table>(0);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 0; i <= num_entries; i++) {
-//       table->append({i, 100.0f + i});
-//     }
+    for (int i = 0; i <= num_entries; i++) {
+      table->append({i, 100.0f + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-
-//     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
-//     table_wrapper->execute();
-//     return table_wrapper;
-//   }
+    table->compress_chunk(ChunkID(0));
+
+    auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
 
-//   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
-//                         std::vector<AllTypeVariant> expected) {
-//     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-//       const auto& chunk = table->get_chunk(chunk_id);
+  void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
+                        std::vector<AllTypeVariant> expected) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
 
-//       for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-//         const auto& column = *chunk.get_column(column_id);
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto& column = *chunk.get_column(column_id);
 
-//         const auto found_value = column[chunk_offset];
-//         const auto comparator = [found_value](const AllTypeVariant expected_value) {
-//           // returns equivalency, not equality to simulate std::multiset.
-//           // multiset cannot be used because it triggers a compiler / lib bug when built in CI
-//           return !(found_value < expected_value) && !(expected_value < found_value);
-//         };
-
-//         auto search = std::find_if(expected.begin(), expected.end(), comparator);
-
-//         ASSERT_TRUE(search != expected.end());
-//         expected.erase(search);
-//       }
-//     }
-
-//     ASSERT_EQ(expected.size(), 0u);
-//   }
-
-//   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
-// };
-
-// TEST_F(OperatorsTableScanTest, DoubleScan) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
-
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan_1->execute();
-
-//   auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
-//   scan_2->execute();
-
-//   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, EmptyResultScan) {
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
-//   scan_1->execute();
-
-//   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-//     EXPECT_EQ(scan_1->get_output()->get_chunk(i).col_count(), 2u);
-// }
-
-// TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
-
-//   auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan->execute();
-
-//   EXPECT_TABLE_EQ(scan->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106};
-//   for (const auto& test : tests) {
-//     auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
-//     scan1->execute();
-
-//     auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
-//     scan2->execute();
-
-//     ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
-
-//   auto table_wrapper = get_table_op_part_dict();
-//   auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
-//   scan_1->execute();
-
-//   EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = all_rows;
-//   tests[ScanType::OpLessThanEquals] = all_rows;
-//   tests[ScanType::OpGreaterThan] = no_rows;
-//   tests[ScanType::OpGreaterThanEquals] = no_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = no_rows;
-//   tests[ScanType::OpLessThanEquals] = no_rows;
-//   tests[ScanType::OpGreaterThan] = all_rows;
-//   tests[ScanType::OpGreaterThanEquals] = all_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
-//   // scanning for a value that is around the dictionary's bounds
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {100};
-//   tests[ScanType::OpLessThan] = {};
-//   tests[ScanType::OpLessThanEquals] = {100};
-//   tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
-//   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
-//   scan_1->execute();
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
-
-//   // scan_1 produced an empty result
-//   auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
-//   // 2**8 + 1 values require a data type of 16bit.
-//   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
-//   auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
-//   scan_1->execute();
-
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
-
-//   // 2**16 + 1 values require a data type of 32bit.
-//   const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
-//   auto scan_2 =
-//       std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
-// }
+        const auto found_value = column[chunk_offset];
+        const auto comparator = [found_value](const AllTypeVariant expected_value) {
+          // returns equivalency, not equality to simulate std::multiset.
+          // multiset cannot be used because it triggers a compiler / lib bug when built in CI
+          return !(found_value < expected_value) && !(expected_value < found_value);
+        };
+
+        auto search = std::find_if(expected.begin(), expected.end(), comparator);
+
+        ASSERT_TRUE(search != expected.end());
+        expected.erase(search);
+      }
+    }
+
+    ASSERT_EQ(expected.size(), 0u);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, DoubleScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultScan) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
+  scan_1->execute();
+
+  for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i).col_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106};
+  for (const auto& test : tests) {
+    auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
+    scan1->execute();
+
+    auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
+    scan2->execute();
+
+    ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
+
+  auto table_wrapper = get_table_op_part_dict();
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan_1->execute();
+
+  EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = all_rows;
+  tests[ScanType::OpLessThanEquals] = all_rows;
+  tests[ScanType::OpGreaterThan] = no_rows;
+  tests[ScanType::OpGreaterThanEquals] = no_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = no_rows;
+  tests[ScanType::OpLessThanEquals] = no_rows;
+  tests[ScanType::OpGreaterThan] = all_rows;
+  tests[ScanType::OpGreaterThanEquals] = all_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
+  // scanning for a value that is around the dictionary's bounds
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {100};
+  tests[ScanType::OpLessThan] = {};
+  tests[ScanType::OpLessThanEquals] = {100};
+  tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
+  auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
+
+  // scan_1 produced an empty result
+  auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
+  // 2**8 + 1 values require a data type of 16bit.
+  const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
+  auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  scan_1->execute();
+
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
+
+  // 2**16 + 1 values require a data type of 32bit.
+  const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
+  auto scan_2 =
+      std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
+}
+
+TEST_F(OperatorsTableScanTest, ScanInParallel) {
+  // Records the workers that read the column. The first read of each chunk takes a while, so that the jobs are not
+  // all done by the first worker that starts.
+  class WorkerRecordingColumn : public BaseColumn {
+   public:
+    WorkerRecordingColumn(std::set<uint32_t>& worker_ids, std::mutex& mutex) : _worker_ids(worker_ids), _mutex(mutex) {}
+
+    const AllTypeVariant operator[](const size_t i) const override {
+      if (i == 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds{200});
+        if (const auto worker = Worker::get_this_thread_worker()) {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _worker_ids.insert(worker->id());
+        }
+      }
+      return _values[i];
+    }
+    void append(const AllTypeVariant& val) override { _values.append(val); }
+    size_t size() const override { return _values.size(); }
+    size_t estimate_memory_usage() const override { return _values.estimate_memory_usage(); }
+
+   protected:
+    std::set<uint32_t>& _worker_ids;
+    std::mutex& _mutex;
+    ValueColumn<int> _values;
+  };
+
+  std::set<uint32_t> worker_ids;
+  std::mutex mutex;
+  auto table = std::make_shared<Table>(10);
+  table->add_column_definition("a", "int");
+  for (auto begin = 0; begin < 1000; begin += 10) {
+    Chunk chunk;
+    chunk.add_column(std::make_shared<WorkerRecordingColumn>(worker_ids, mutex));
+    for (auto i = begin; i < begin + 10; ++i) chunk.append({i % 7});
+    table->emplace_chunk(std::move(chunk));
+  }
+  ASSERT_EQ(table->chunk_count(), 100u);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Without a scheduler, the chunks are scanned one after another on this thread
+  auto single_threaded_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  single_threaded_scan->execute();
+  EXPECT_TRUE(worker_ids.empty());
+
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  scan->execute();
+  EXPECT_GT(worker_ids.size(), 1u);
+
+  // The output chunks are in the order of the input chunks
+  const auto& output = *scan->get_output();
+  EXPECT_EQ(output.row_count(), 143u);
+  EXPECT_TABLE_EQ(output, *single_threaded_scan->get_output(), true);
+  auto previous_chunk_id = ChunkID{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<ReferenceColumn>(output.get_chunk(chunk_id).get_column(ColumnID{0}));
+    ASSERT_TRUE(column);
+    EXPECT_GE(column->pos_list()->front().chunk_id, previous_chunk_id);
+    previous_chunk_id = column->pos_list()->front().chunk_id;
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWhileCompressing) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 1000; ++i) table->append({i % 7});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The scan pins the chunks it reads, so compressing them meanwhile does not change its result
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  auto compression = std::thread([&]() {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  });
+  scan->execute();
+  compression.join();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 143u);
+}
 
 }  // namespace opossum
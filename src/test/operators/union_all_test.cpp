@@ -0,0 +1,84 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsUnionAllTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto i = 0; i < 5; ++i) _table->append({i, std::to_string(i)});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionAllTest, ConcatenatesInputs) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2);
+  scan->execute();
+
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, scan);
+  union_all->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  for (auto i = 0; i < 5; ++i) expected->append({i, std::to_string(i)});
+  for (auto i = 0; i < 2; ++i) expected->append({i, std::to_string(i)});
+
+  EXPECT_TABLE_EQ(union_all->get_output(), expected, true);
+}
+
+TEST_F(OperatorsUnionAllTest, SharesChunks) {
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, _table_wrapper);
+  union_all->execute();
+
+  const auto& output = *union_all->get_output();
+  ASSERT_EQ(output.chunk_count(), 2 * _table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output.get_shared_chunk(chunk_id), _table->get_shared_chunk(chunk_id));
+    EXPECT_EQ(output.get_shared_chunk(ChunkID{chunk_id + _table->chunk_count()}),
+              _table->get_shared_chunk(chunk_id));
+  }
+}
+
+TEST_F(OperatorsUnionAllTest, EmptyInput) {
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column_definition("x", "int");
+  empty_table->add_column_definition("y", "string");
+  auto empty_table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_table_wrapper->execute();
+
+  auto union_all = std::make_shared<UnionAll>(empty_table_wrapper, _table_wrapper);
+  union_all->execute();
+
+  EXPECT_EQ(union_all->get_output()->column_name(ColumnID{0}), "x");
+  EXPECT_EQ(union_all->get_output()->row_count(), 5u);
+}
+
+TEST_F(OperatorsUnionAllTest, DifferentColumnTypesThrow) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  projection->execute();
+
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, projection);
+  EXPECT_THROW(union_all->execute(), std::logic_error);
+}
+
+}  // namespace opossum
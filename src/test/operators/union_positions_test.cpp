@@ -0,0 +1,95 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsUnionPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (auto i = 0; i < 10; ++i) _table->append({i, i % 3});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableScan> _scan(const ColumnID column_id, const ScanType scan_type, const int value) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionPositionsTest, UnitesAndRemovesDuplicates) {
+  // a < 4 OR b = 0
+  auto union_positions = std::make_shared<UnionPositions>(_scan(ColumnID{0}, ScanType::OpLessThan, 4),
+                                                          _scan(ColumnID{1}, ScanType::OpEquals, 0));
+  union_positions->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "int");
+  for (auto i = 0; i < 10; ++i) {
+    if (i < 4 || i % 3 == 0) expected->append({i, i % 3});
+  }
+
+  EXPECT_TABLE_EQ(union_positions->get_output(), expected, true);
+
+  const auto& output_chunk = union_positions->get_output()->get_chunk(ChunkID{0});
+  const auto column = std::dynamic_pointer_cast<ReferenceColumn>(output_chunk.get_column(ColumnID{1}));
+  ASSERT_TRUE(column);
+  EXPECT_EQ(column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsUnionPositionsTest, SameInputTwice) {
+  auto scan = _scan(ColumnID{1}, ScanType::OpNotEquals, 1);
+  auto union_positions = std::make_shared<UnionPositions>(scan, scan);
+  union_positions->execute();
+
+  EXPECT_TABLE_EQ(union_positions->get_output(), scan->get_output(), true);
+}
+
+TEST_F(OperatorsUnionPositionsTest, EmptyInputs) {
+  auto empty_scan = _scan(ColumnID{0}, ScanType::OpGreaterThan, 100);
+  auto scan = _scan(ColumnID{0}, ScanType::OpGreaterThan, 7);
+
+  auto union_positions = std::make_shared<UnionPositions>(empty_scan, scan);
+  union_positions->execute();
+  EXPECT_TABLE_EQ(union_positions->get_output(), scan->get_output(), true);
+
+  auto empty_union = std::make_shared<UnionPositions>(empty_scan, empty_scan);
+  empty_union->execute();
+  EXPECT_EQ(empty_union->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_union->get_output()->col_count(), 2u);
+}
+
+TEST_F(OperatorsUnionPositionsTest, DifferentColumnsThrow) {
+  auto scan = _scan(ColumnID{0}, ScanType::OpLessThan, 4);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  projection->execute();
+
+  auto union_positions = std::make_shared<UnionPositions>(scan, projection);
+  EXPECT_THROW(union_positions->execute(), std::logic_error);
+
+  auto union_with_values = std::make_shared<UnionPositions>(scan, _table_wrapper);
+  EXPECT_THROW(union_with_values->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,250 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {
+ protected:
+  // Creates a -> (b, c) -> d and checks that every task only runs after its predecessors
+  void _check_dependencies() {
+    std::atomic_uint counter{0};
+    std::vector<uint32_t> order(4);
+
+    std::vector<std::shared_ptr<AbstractTask>> tasks;
+    for (auto index = 0u; index < 4; ++index) {
+      tasks.push_back(std::make_shared<JobTask>([&, index]() { order[index] = counter++; }));
+    }
+    tasks[0]->set_as_predecessor_of(tasks[1]);
+    tasks[0]->set_as_predecessor_of(tasks[2]);
+    tasks[1]->set_as_predecessor_of(tasks[3]);
+    tasks[2]->set_as_predecessor_of(tasks[3]);
+
+    // Schedule in reverse order so that waiting tasks are scheduled before their predecessors
+    CurrentScheduler::schedule_tasks(std::vector<std::shared_ptr<AbstractTask>>(tasks.rbegin(), tasks.rend()));
+    CurrentScheduler::wait_for_tasks(tasks);
+
+    EXPECT_EQ(order[0], 0u);
+    EXPECT_LT(order[1], order[3]);
+    EXPECT_LT(order[2], order[3]);
+    EXPECT_EQ(order[3], 3u);
+  }
+
+  std::shared_ptr<TableWrapper> _make_table_wrapper() {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    for (auto i = 0; i < 20; ++i) table->append({(i * 7) % 20});
+    return std::make_shared<TableWrapper>(table);
+  }
+};
+
+TEST_F(SchedulerTest, ExecutesWithoutScheduler) { _check_dependencies(); }
+
+TEST_F(SchedulerTest, RespectsDependencies) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+  for (auto repetition = 0; repetition < 20; ++repetition) _check_dependencies();
+}
+
+TEST_F(SchedulerTest, ExecutesOperatorTrees) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  // The wrapper is the input of both scans, but only gets a single task
+  auto table_wrapper = _make_table_wrapper();
+  auto left_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto right_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 15);
+  auto union_all = std::make_shared<UnionAll>(left_scan, right_scan);
+  auto sort = std::make_shared<Sort>(union_all, ColumnID{0});
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(sort);
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_EQ(tasks.front()->get_operator(), table_wrapper);
+  EXPECT_EQ(tasks.back()->get_operator(), sort);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (auto value : {0, 1, 2, 3, 4, 15, 16, 17, 18, 19}) expected->append({value});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(SchedulerTest, SkipsExecutedOperators) {
+  auto table_wrapper = _make_table_wrapper();
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan);
+  ASSERT_EQ(tasks.size(), 1u);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(scan->get_output()->row_count(), 5u);
+}
+
+TEST_F(SchedulerTest, ExecutesOperatorsAsynchronously) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(1));
+
+  // Keeps the only worker busy, so that execute_async would never return if it waited for the operators
+  std::atomic_bool may_start{false};
+  auto blocking_task = std::make_shared<JobTask>([&]() {
+    while (!may_start) std::this_thread::yield();
+  });
+  blocking_task->schedule();
+
+  auto table_wrapper = _make_table_wrapper();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto sort = std::make_shared<Sort>(scan, ColumnID{0});
+  auto future = sort->execute_async();
+  EXPECT_EQ(future.wait_for(std::chrono::seconds{0}), std::future_status::timeout);
+  may_start = true;
+
+  const auto output = future.get();
+  EXPECT_EQ(output, sort->get_output());
+  EXPECT_EQ(output->row_count(), 5u);
+  blocking_task->join();
+}
+
+TEST_F(SchedulerTest, ExecutesOperatorsAsynchronouslyWithoutScheduler) {
+  auto scan = std::make_shared<TableScan>(_make_table_wrapper(), ColumnID{0}, ScanType::OpLessThan, 5);
+  auto future = scan->execute_async();
+
+  EXPECT_EQ(future.wait_for(std::chrono::seconds{0}), std::future_status::ready);
+  EXPECT_EQ(future.get()->row_count(), 5u);
+
+  // Executed operators are not executed again
+  EXPECT_EQ(scan->execute_async().get(), scan->get_output());
+}
+
+TEST_F(SchedulerTest, PassesExceptionsToFutures) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(2));
+
+  auto failing_scan = std::make_shared<TableScan>(_make_table_wrapper(), ColumnID{3}, ScanType::OpLessThan, 5);
+  auto sort = std::make_shared<Sort>(failing_scan, ColumnID{0});
+  EXPECT_THROW(sort->execute_async().get(), std::logic_error);
+  EXPECT_EQ(sort->get_output(), nullptr);
+}
+
+TEST_F(SchedulerTest, PassesExceptionsOn) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(2));
+
+  auto executed = false;
+  auto failing_task = std::make_shared<JobTask>([]() { throw std::logic_error("failed"); });
+  auto successor = std::make_shared<JobTask>([&]() { executed = true; });
+  failing_task->set_as_predecessor_of(successor);
+
+  const auto tasks = std::vector<std::shared_ptr<JobTask>>{failing_task, successor};
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::logic_error);
+  EXPECT_THROW(successor->join(), std::logic_error);
+  EXPECT_FALSE(executed);
+}
+
+TEST_F(SchedulerTest, WorkersStealTasks) {
+  const auto scheduler = std::make_shared<WorkStealingScheduler>(4);
+  CurrentScheduler::set(scheduler);
+
+  // All tasks are scheduled from within one task and thus end up in the queue of a single worker
+  std::vector<std::shared_ptr<JobTask>> jobs;
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    for (auto index = 0; index < 40; ++index) {
+      jobs.push_back(std::make_shared<JobTask>([]() { std::this_thread::sleep_for(std::chrono::milliseconds{1}); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{outer_task});
+
+  // Workers count a task after it is done, so we wait for them to stop
+  scheduler->finish();
+
+  auto executed_task_count = uint64_t{0};
+  auto stolen_task_count = uint64_t{0};
+  for (const auto& worker : scheduler->workers()) {
+    executed_task_count += worker->executed_task_count();
+    stolen_task_count += worker->stolen_task_count();
+  }
+  EXPECT_EQ(executed_task_count, 41u);
+  EXPECT_GT(stolen_task_count, 0u);
+}
+
+TEST_F(SchedulerTest, TaskQueue) {
+  TaskQueue queue;
+  EXPECT_EQ(queue.pull(), nullptr);
+
+  auto first = std::make_shared<JobTask>([]() {});
+  auto second = std::make_shared<JobTask>([]() {});
+  queue.push(first);
+  queue.push(second);
+
+  EXPECT_EQ(queue.steal(), second);
+  EXPECT_EQ(queue.pull(), first);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, FakeTopology) {
+  const auto topology = Topology::create_fake_numa_topology(2, 3);
+  EXPECT_TRUE(topology->is_fake());
+  EXPECT_EQ(topology->node_count(), 2u);
+  EXPECT_EQ(topology->cpu_count(), 6u);
+
+  const auto scheduler = std::make_shared<WorkStealingScheduler>(topology);
+  CurrentScheduler::set(scheduler);
+  ASSERT_EQ(scheduler->workers().size(), 6u);
+  EXPECT_EQ(scheduler->workers()[2]->node_id(), NodeID{0});
+  EXPECT_EQ(scheduler->workers()[3]->node_id(), NodeID{1});
+}
+
+TEST_F(SchedulerTest, NumaTopology) {
+  const auto topology = Topology::create_numa_topology(2);
+  EXPECT_GE(topology->node_count(), 1u);
+  EXPECT_LE(topology->cpu_count(), 2u);
+
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(topology));
+  _check_dependencies();
+}
+
+TEST_F(SchedulerTest, PrefersNodeOfTask) {
+  const auto scheduler = std::make_shared<WorkStealingScheduler>(Topology::create_fake_numa_topology(2, 1));
+  CurrentScheduler::set(scheduler);
+
+  // The worker of node 0 is kept busy until all other tasks are done, so it cannot steal them
+  std::atomic_uint finished_count{0};
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  auto blocking_task = std::make_shared<JobTask>([&]() {
+    while (finished_count < 10) std::this_thread::yield();
+  });
+  blocking_task->set_preferred_node(NodeID{0});
+  tasks.push_back(blocking_task);
+
+  std::vector<NodeID> executing_nodes(10);
+  for (auto index = 0u; index < 10; ++index) {
+    auto task = std::make_shared<JobTask>([&, index]() {
+      executing_nodes[index] = Worker::get_this_thread_worker()->node_id();
+      ++finished_count;
+    });
+    task->set_preferred_node(NodeID{1});
+    tasks.push_back(task);
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  for (const auto& node_id : executing_nodes) EXPECT_EQ(node_id, NodeID{1});
+}
+
+}  // namespace opossum
@@ -0,0 +1,182 @@
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/base_column.hpp"
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+    _table->append({4, "four"});
+    _table->append({5, "five"});
+    _table->compress_chunk(ChunkID{0});
+
+    _expected = std::make_shared<Table>();
+    _expected->add_column("a", "int");
+    _expected->add_column("b", "string");
+    for (const auto& row : {std::make_pair(1, "one"), std::make_pair(2, "two"), std::make_pair(3, "three"),
+                            std::make_pair(4, "four"), std::make_pair(5, "five")}) {
+      _expected->append({row.first, row.second});
+    }
+  }
+
+  static bool _file_exists(const std::string& file_name) { return std::ifstream(file_name).is_open(); }
+
+  const std::string _file_prefix = "buffer_manager_test.";
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected;
+};
+
+TEST_F(StorageBufferManagerTest, EvictsToBudget) {
+  auto& buffer_manager = BufferManager::get();
+  _table->make_evictable(_file_prefix);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1}).is_evictable());
+  EXPECT_GT(buffer_manager.memory_usage(), 0u);
+
+  buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(buffer_manager.memory_usage(), 0u);
+  EXPECT_EQ(buffer_manager.eviction_count(), 6u);
+  EXPECT_TRUE(_file_exists(_file_prefix + "2"));
+
+  // Columns are loaded on access, the one that was loaded last stays in memory even though it exceeds the budget
+  EXPECT_EQ(_table->get_chunk(ChunkID{1}).size(), 2u);
+  EXPECT_EQ(buffer_manager.load_count(), 0u);
+  EXPECT_TABLE_EQ(_table, _expected, true);
+  EXPECT_EQ(buffer_manager.load_count(), 6u);
+  EXPECT_GT(buffer_manager.eviction_count(), 6u);
+  EXPECT_GT(buffer_manager.memory_usage(), 0u);
+
+  // The files are removed with the table
+  _table = nullptr;
+  EXPECT_FALSE(_file_exists(_file_prefix + "2"));
+}
+
+TEST_F(StorageBufferManagerTest, DoesNotEvictColumnsInUse) {
+  _table->make_evictable(_file_prefix);
+  const auto column = _table->get_chunk(ChunkID{0}).get_column(ColumnID{1});
+
+  BufferManager::get().set_memory_budget(0);
+  EXPECT_EQ(BufferManager::get().eviction_count(), 5u);
+  EXPECT_EQ((*column)[1], AllTypeVariant{"two"});
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).get_column(ColumnID{1}), column);
+}
+
+TEST_F(StorageBufferManagerTest, ForgetsColumnsOfDestroyedTables) {
+  auto& buffer_manager = BufferManager::get();
+  _table->make_evictable(_file_prefix);
+  const auto table_memory_usage = buffer_manager.memory_usage();
+  _expected->make_evictable(_file_prefix + "expected.");
+  const auto expected_memory_usage = buffer_manager.memory_usage() - table_memory_usage;
+
+  // The memory of a destroyed table is not counted anymore, so the other table's columns fit into the budget
+  _table = nullptr;
+  EXPECT_EQ(buffer_manager.memory_usage(), expected_memory_usage);
+  buffer_manager.set_memory_budget(expected_memory_usage);
+  EXPECT_EQ(buffer_manager.eviction_count(), 0u);
+
+  buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(buffer_manager.eviction_count(), 2u);
+  EXPECT_EQ(buffer_manager.memory_usage(), 0u);
+}
+
+TEST_F(StorageBufferManagerTest, CannotCompressEvictableChunks) {
+  _table->make_evictable(_file_prefix);
+  EXPECT_THROW(_table->compress_chunk(ChunkID{1}), std::exception);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1}).is_evictable());
+}
+
+TEST_F(StorageBufferManagerTest, PrefersColumnsThatWereNotAccessed) {
+  _table->make_evictable(_file_prefix);
+  auto& buffer_manager = BufferManager::get();
+
+  // The first column of the first chunk is evicted, which frees enough memory
+  buffer_manager.set_memory_budget(buffer_manager.memory_usage() - 1);
+  EXPECT_EQ(buffer_manager.eviction_count(), 1u);
+
+  // Loading that column evicts a column that was not accessed rather than the columns that were
+  const auto& first_chunk = _table->get_chunk(ChunkID{0});
+  const auto& second_chunk = _table->get_chunk(ChunkID{1});
+  first_chunk.get_column(ColumnID{1});
+  second_chunk.get_column(ColumnID{0});
+  first_chunk.get_column(ColumnID{0});
+  EXPECT_EQ(buffer_manager.eviction_count(), 2u);
+  EXPECT_EQ(buffer_manager.load_count(), 1u);
+  EXPECT_TRUE(first_chunk.get_column_if_resident(ColumnID{0}));
+  EXPECT_TRUE(first_chunk.get_column_if_resident(ColumnID{1}));
+  EXPECT_TRUE(second_chunk.get_column_if_resident(ColumnID{0}));
+}
+
+TEST_F(StorageBufferManagerTest, LoadsOnlyAccessedColumns) {
+  _table->make_evictable(_file_prefix, BlockCompression::Lz);
+  auto& buffer_manager = BufferManager::get();
+  buffer_manager.set_memory_budget(0);
+
+  const auto column = _table->get_chunk(ChunkID{1}).get_column(ColumnID{1});
+  EXPECT_EQ(buffer_manager.load_count(), 1u);
+  EXPECT_EQ(buffer_manager.memory_usage(), column->estimate_memory_usage());
+  EXPECT_EQ((*column)[0], AllTypeVariant{"three"});
+
+  buffer_manager.set_memory_budget(std::numeric_limits<size_t>::max());
+  EXPECT_TABLE_EQ(_table, _expected, true);
+  EXPECT_EQ(buffer_manager.load_count(), 6u);
+}
+
+TEST_F(StorageBufferManagerTest, CompressesColumns) {
+  const auto make_table = [] {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 1000; ++row) table->append({row % 10, "value " + std::to_string(row % 10)});
+    return table;
+  };
+
+  // The columns are only held by the EvictableColumns once the tables are gone, so that they can be evicted
+  const auto file_name = _file_prefix + "compressed";
+  auto table = make_table();
+  const auto uncompressed = std::make_shared<EvictableColumns>(table->column_types(), table->get_chunk(ChunkID{0}),
+                                                               file_name + "0", BlockCompression::None);
+  table = make_table();
+  const auto compressed = std::make_shared<EvictableColumns>(table->column_types(), table->get_chunk(ChunkID{0}),
+                                                             file_name + "1", BlockCompression::Lz);
+  table = make_table();
+
+  for (ColumnID column_id{0}; column_id < 2; ++column_id) {
+    EXPECT_LT(compressed->stored_size(column_id), uncompressed->stored_size(column_id) / 4);
+
+    EXPECT_TRUE(compressed->try_evict(column_id));
+    EXPECT_FALSE(compressed->is_resident(column_id));
+    const auto column = compressed->get_column(column_id);
+    EXPECT_TRUE(compressed->is_resident(column_id));
+    ASSERT_EQ(column->size(), 1000u);
+    for (ChunkOffset offset{0}; offset < 1000; offset += 99) {
+      EXPECT_EQ((*column)[offset], (*table->get_chunk(ChunkID{0}).get_column(column_id))[offset]);
+    }
+  }
+}
+
+TEST_F(StorageBufferManagerTest, AppendsToNewChunk) {
+  _table->make_evictable(_file_prefix);
+  _table->append({6, "six"});
+  EXPECT_EQ(_table->chunk_count(), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{2}).size(), 1u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{3}).is_evictable());
+
+  EXPECT_THROW(_table->get_chunk(ChunkID{2}).append({7, "seven"}), std::exception);
+}
+
+}  // namespace opossum
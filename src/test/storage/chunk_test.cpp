@@ -49,6 +49,20 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, Version) {
+  auto version = c.version();
+  c.add_column(vc_int);
+  EXPECT_GT(c.version(), version);
+
+  version = c.version();
+  c.append({2});
+  EXPECT_GT(c.version(), version);
+
+  // Versions are unique across chunks
+  Chunk other_chunk;
+  EXPECT_NE(other_chunk.version(), c.version());
+}
+
 TEST_F(StorageChunkTest, RetrieveColumn) {
   c.add_column(vc_int);
   c.add_column(vc_str);
@@ -0,0 +1,213 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/materialized_aggregate.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageMaterializedAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("minute", "int");
+    _table->add_column("value", "int");
+    _table->add_column("name", "string");
+    _table->append({1, 10, "b"});
+    _table->append({2, 5, "c"});
+    _table->append({1, 20, "a"});
+  }
+
+  std::shared_ptr<MaterializedAggregate> _make_aggregate() {
+    return std::make_shared<MaterializedAggregate>(
+        _table, std::vector<ColumnID>{ColumnID{0}},
+        std::vector<AggregateDefinition>{{ColumnID{1}, AggregateFunction::Count},
+                                         {ColumnID{1}, AggregateFunction::Sum},
+                                         {ColumnID{1}, AggregateFunction::Avg},
+                                         {ColumnID{2}, AggregateFunction::Min},
+                                         {ColumnID{1}, AggregateFunction::Max}});
+  }
+
+  std::shared_ptr<Table> _expected_table() {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("minute", "int");
+    expected->add_column("COUNT(value)", "long");
+    expected->add_column("SUM(value)", "long");
+    expected->add_column("AVG(value)", "double");
+    expected->add_column("MIN(name)", "string");
+    expected->add_column("MAX(value)", "int");
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageMaterializedAggregateTest, AggregatesGroups) {
+  auto aggregate = _make_aggregate();
+
+  auto expected = _expected_table();
+  expected->append({1, int64_t{2}, int64_t{30}, 15.0, "a", 20});
+  expected->append({2, int64_t{1}, int64_t{5}, 5.0, "c", 5});
+  EXPECT_TABLE_EQ(aggregate->refresh(), expected, true);
+}
+
+TEST_F(StorageMaterializedAggregateTest, OnlyAggregatesAppendedRows) {
+  auto aggregate = _make_aggregate();
+  const auto first_result = aggregate->refresh();
+  EXPECT_EQ(aggregate->watermark(), (RowID{ChunkID{1}, 1}));
+
+  // Without new rows, the result does not change, even if chunks are compressed
+  _table->compress_chunk(ChunkID{0});
+  EXPECT_EQ(aggregate->refresh(), first_result);
+
+  _table->append({2, 7, "d"});
+  _table->append({3, 1, "e"});
+  _table->append({1, 3, "z"});
+
+  auto expected = _expected_table();
+  expected->append({1, int64_t{3}, int64_t{33}, 11.0, "a", 20});
+  expected->append({2, int64_t{2}, int64_t{12}, 6.0, "c", 7});
+  expected->append({3, int64_t{1}, int64_t{1}, 1.0, "e", 1});
+  EXPECT_TABLE_EQ(aggregate->refresh(), expected, true);
+  EXPECT_EQ(aggregate->watermark(), (RowID{ChunkID{2}, 2}));
+
+  // The same as aggregating all rows at once
+  EXPECT_TABLE_EQ(_make_aggregate()->refresh(), expected, true);
+}
+
+TEST_F(StorageMaterializedAggregateTest, OnlyReadsAppendedRowsOfGrowingChunk) {
+  // Counts how often its values are read, which materialize_values does through operator[] for unknown columns
+  class CountingColumn : public BaseColumn {
+   public:
+    const AllTypeVariant operator[](const size_t i) const override {
+      ++read_count;
+      return _values[i];
+    }
+    void append(const AllTypeVariant& val) override { _values.append(val); }
+    size_t size() const override { return _values.size(); }
+    size_t estimate_memory_usage() const override { return _values.estimate_memory_usage(); }
+
+    mutable size_t read_count = 0;
+
+   protected:
+    ValueColumn<int> _values;
+  };
+
+  // With an unlimited chunk size, all rows are appended to the same chunk
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("value", "int");
+  const auto column = std::make_shared<CountingColumn>();
+  Chunk chunk;
+  chunk.add_column(column);
+  table->emplace_chunk(std::move(chunk));
+  for (auto value = 1; value <= 100; ++value) table->append({value});
+
+  MaterializedAggregate aggregate(table, {},
+                                  {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{0}, AggregateFunction::Max}});
+  aggregate.refresh();
+  EXPECT_EQ(column->read_count, 200u);
+
+  column->read_count = 0;
+  table->append({1000});
+  table->append({1});
+  const auto result = aggregate.refresh();
+  EXPECT_EQ(column->read_count, 4u);
+  EXPECT_EQ(aggregate.watermark(), (RowID{ChunkID{0}, 102}));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("SUM(value)", "long");
+  expected->add_column("MAX(value)", "int");
+  expected->append({int64_t{6051}, 1000});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(StorageMaterializedAggregateTest, WithoutGroupBy) {
+  auto aggregate = std::make_shared<MaterializedAggregate>(
+      _table, std::vector<ColumnID>{}, std::vector<AggregateDefinition>{{ColumnID{1}, AggregateFunction::Sum}});
+  aggregate->refresh();
+  _table->append({3, 1, "e"});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("SUM(value)", "long");
+  expected->append({int64_t{36}});
+  EXPECT_TABLE_EQ(aggregate->refresh(), expected);
+}
+
+TEST_F(StorageMaterializedAggregateTest, OrdersGroupsAddedLater) {
+  MaterializedAggregate aggregate(_table, {ColumnID{2}}, {{ColumnID{1}, AggregateFunction::Sum}});
+  aggregate.refresh();
+
+  // The new groups are sorted in between the existing ones
+  _table->append({4, 1, "aa"});
+  _table->append({4, 2, "0"});
+  _table->append({4, 3, "bb"});
+  _table->append({4, 4, "a"});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("name", "string");
+  expected->add_column("SUM(value)", "long");
+  expected->append({"0", int64_t{2}});
+  expected->append({"a", int64_t{24}});
+  expected->append({"aa", int64_t{1}});
+  expected->append({"b", int64_t{10}});
+  expected->append({"bb", int64_t{3}});
+  expected->append({"c", int64_t{5}});
+  EXPECT_TABLE_EQ(aggregate.refresh(), expected, true);
+}
+
+TEST_F(StorageMaterializedAggregateTest, MultipleGroupByColumns) {
+  MaterializedAggregate aggregate(_table, {ColumnID{0}, ColumnID{2}}, {{ColumnID{1}, AggregateFunction::Count}});
+  aggregate.refresh();
+  _table->append({1, 7, "b"});
+  _table->append({0, 7, "z"});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("minute", "int");
+  expected->add_column("name", "string");
+  expected->add_column("COUNT(value)", "long");
+  expected->append({0, "z", int64_t{1}});
+  expected->append({1, "a", int64_t{1}});
+  expected->append({1, "b", int64_t{2}});
+  expected->append({2, "c", int64_t{1}});
+  EXPECT_TABLE_EQ(aggregate.refresh(), expected, true);
+}
+
+TEST_F(StorageMaterializedAggregateTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  MaterializedAggregate aggregate(table, {ColumnID{0}}, {{ColumnID{0}, AggregateFunction::Count}});
+
+  const auto result = aggregate.refresh();
+  EXPECT_EQ(result->row_count(), 0u);
+  EXPECT_EQ(result->col_count(), 2u);
+
+  table->append({4});
+  EXPECT_EQ(aggregate.refresh()->row_count(), 1u);
+}
+
+TEST_F(StorageMaterializedAggregateTest, StringsCannotBeSummedUp) {
+  EXPECT_THROW(MaterializedAggregate(_table, {}, {{ColumnID{2}, AggregateFunction::Sum}}), std::exception);
+}
+
+TEST_F(StorageMaterializedAggregateTest, RefreshedByStorageManager) {
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_materialized_aggregate("rollup", _make_aggregate());
+  EXPECT_EQ(storage_manager.get_table("rollup")->row_count(), 2u);
+
+  _table->append({3, 1, "e"});
+  EXPECT_EQ(storage_manager.get_table("rollup")->row_count(), 2u);
+  storage_manager.refresh_materialized_aggregates();
+  EXPECT_EQ(storage_manager.get_table("rollup")->row_count(), 3u);
+
+  storage_manager.drop_table("rollup");
+  EXPECT_THROW(storage_manager.get_materialized_aggregate("rollup"), std::exception);
+}
+
+}  // namespace opossum
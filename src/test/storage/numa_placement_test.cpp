@@ -0,0 +1,82 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageNumaPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto i = 0; i < 12; ++i) _table->append({i, std::to_string(i)});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageNumaPlacementTest, Policies) {
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{0}, ChunkID{6}, 2, NumaPlacementPolicy::RoundRobin), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{1}, ChunkID{6}, 2, NumaPlacementPolicy::RoundRobin), NodeID{1});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{4}, ChunkID{6}, 2, NumaPlacementPolicy::RoundRobin), NodeID{0});
+
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{0}, ChunkID{6}, 2, NumaPlacementPolicy::ChunkRanges), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{2}, ChunkID{6}, 2, NumaPlacementPolicy::ChunkRanges), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{3}, ChunkID{6}, 2, NumaPlacementPolicy::ChunkRanges), NodeID{1});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{5}, ChunkID{6}, 2, NumaPlacementPolicy::ChunkRanges), NodeID{1});
+}
+
+TEST_F(StorageNumaPlacementTest, AssignsNodesToChunks) {
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).node_id(), INVALID_NODE_ID);
+
+  _table->compress_chunk(ChunkID{1});
+  place_chunks_on_nodes(*_table, *Topology::create_fake_numa_topology(3, 1), NumaPlacementPolicy::ChunkRanges);
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id).node_id(), NodeID{chunk_id / 2});
+  }
+
+  // Compressing keeps the node
+  _table->compress_chunk(ChunkID{5});
+  EXPECT_EQ(_table->get_chunk(ChunkID{5}).node_id(), NodeID{2});
+}
+
+TEST_F(StorageNumaPlacementTest, MovesMemoryOfActualNodes) {
+  // On machines with a single node, this moves the memory to the node it already is on
+  _table->compress_chunk(ChunkID{0});
+  const auto topology = Topology::create_numa_topology();
+  place_chunks_on_nodes(*_table, *topology);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  for (auto i = 0; i < 12; ++i) expected->append({i, std::to_string(i)});
+  EXPECT_TABLE_EQ(_table, expected, true);
+}
+
+TEST_F(StorageNumaPlacementTest, ScanPlacedTable) {
+  const auto topology = Topology::create_fake_numa_topology(2, 2);
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(topology));
+  place_chunks_on_nodes(*_table, *topology);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5);
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 7u);
+}
+
+}  // namespace opossum
@@ -1,10 +1,17 @@
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/work_stealing_scheduler.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/storage_manager.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
 
 namespace opossum {
 
@@ -64,4 +71,37 @@ TEST_F(StorageStorageManagerTest, AfterResetDifferentObject) {
 
   EXPECT_NE(&sm1, &sm2);
 }
+
+TEST_F(StorageStorageManagerTest, Snapshot) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  auto& sm = StorageManager::get();
+  const auto all_types = load_table("src/test/tables/all_types.tbl", 2);
+  all_types->compress_chunk(ChunkID{1});
+  sm.add_table("all_types", all_types);
+  sm.add_table("int_float", load_table("src/test/tables/int_float.tbl", 1));
+
+  std::stringstream snapshot;
+  sm.write_snapshot(snapshot);
+
+  StorageManager::reset();
+  auto& restored = StorageManager::get();
+  restored.load_snapshot(snapshot);
+
+  const auto table_names = std::vector<std::string>{"all_types", "first_table", "int_float", "second_table"};
+  EXPECT_EQ(restored.table_names(), table_names);
+  EXPECT_TABLE_EQ(restored.get_table("all_types"), load_table("src/test/tables/all_types.tbl", 2), true);
+  EXPECT_TABLE_EQ(restored.get_table("int_float"), load_table("src/test/tables/int_float.tbl", 1), true);
+  EXPECT_EQ(restored.get_table("int_float")->chunk_count(), 3u);
+  EXPECT_EQ(restored.get_table("second_table")->chunk_size(), 4u);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      restored.get_table("all_types")->get_chunk(ChunkID{1}).get_column(ColumnID{4})));
+}
+
+TEST_F(StorageStorageManagerTest, SnapshotMustBeValid) {
+  std::stringstream snapshot("not a snapshot");
+  EXPECT_THROW(StorageManager::get().load_snapshot(snapshot), std::exception);
+}
+
 }  // namespace opossum
@@ -8,7 +8,9 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
 
 namespace opossum {
 
@@ -71,4 +73,100 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  t.compress_chunk(ChunkID{0});
+
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  auto dictionary_column = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1}));
+  ASSERT_NE(dictionary_column, nullptr);
+  EXPECT_EQ(dictionary_column->get(0), "Hello,");
+  EXPECT_EQ(dictionary_column->get(1), "world");
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, CompressSharedChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+
+  Table other_table{2};
+  other_table.add_column_definition("col_1", "int");
+  other_table.add_column_definition("col_2", "string");
+  other_table.emplace_chunk(t.get_shared_chunk(ChunkID{0}));
+  const auto other_version = other_table.version();
+
+  // The compressed chunk replaces the shared one only in the compressed table
+  t.compress_chunk(ChunkID{0});
+  EXPECT_NE(t.get_shared_chunk(ChunkID{0}), other_table.get_shared_chunk(ChunkID{0}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionaryColumn<int>>(t.get_chunk(ChunkID{0}).get_column(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<int>>(other_table.get_chunk(ChunkID{0}).get_column(ColumnID{0})));
+  EXPECT_EQ(other_table.get_chunk(ChunkID{0}).get_column(ColumnID{1})->operator[](1), AllTypeVariant{"world"});
+  EXPECT_EQ(other_table.version(), other_version);
+}
+
+TEST_F(StorageTableTest, Version) {
+  auto version = t.version();
+  t.append({4, "Hello,"});
+  EXPECT_GT(t.version(), version);
+
+  version = t.version();
+  t.compress_chunk(ChunkID{0});
+  EXPECT_GT(t.version(), version);
+
+  // Versions are unique across tables
+  Table other_table;
+  EXPECT_NE(other_table.version(), t.version());
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({4, "Hello,"});
+  t.append_columns(std::vector<int>{1, 2, 3, 5, 6}, std::vector<std::string>{"a", "b", "c", "d", "e"});
+
+  // The first chunk is not filled up, the new rows are split into chunks of the maximum size
+  EXPECT_EQ(t.row_count(), 6u);
+  EXPECT_EQ(t.chunk_count(), 4u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 1u);
+  EXPECT_EQ(t.get_chunk(ChunkID{3}).size(), 1u);
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).get_column(ColumnID{0})->operator[](1), AllTypeVariant{5});
+  EXPECT_EQ(t.get_chunk(ChunkID{3}).get_column(ColumnID{1})->operator[](0), AllTypeVariant{"e"});
+
+  EXPECT_THROW(t.append_columns(std::vector<int>{1}, std::vector<std::string>{}), std::exception);
+  EXPECT_THROW(t.append_columns(std::vector<int>{1}), std::exception);
+  EXPECT_THROW(t.append_columns(std::vector<float>{1.0f}, std::vector<std::string>{"a"}), std::exception);
+}
+
+TEST_F(StorageTableTest, AppendColumnsReplacesEmptyChunk) {
+  Table table;
+  table.add_column("a", "long");
+  std::vector<int64_t> values{1, 2, 3};
+  const auto data = values.data();
+  table.append_columns(std::move(values));
+
+  // Without a maximum chunk size, the values are moved into a single chunk
+  EXPECT_EQ(table.chunk_count(), 1u);
+  const auto column =
+      std::dynamic_pointer_cast<ValueColumn<int64_t>>(table.get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_TRUE(column);
+  EXPECT_EQ(column->values().data(), data);
+}
+
+TEST_F(StorageTableTest, ChunksChangedSince) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto version = t.version();
+  EXPECT_TRUE(t.chunks_changed_since(version).empty());
+
+  // Appending to the last chunk directly is noticed as well
+  t.get_chunk(ChunkID{1}).append({5, "?"});
+  EXPECT_GT(t.version(), version);
+  EXPECT_EQ(t.chunks_changed_since(version), std::vector<ChunkID>{ChunkID{1}});
+
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(t.chunks_changed_since(version), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+}
+
 }  // namespace opossum
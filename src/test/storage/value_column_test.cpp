@@ -1,4 +1,5 @@
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -47,4 +48,25 @@ TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
   EXPECT_THROW(vc_double.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueColumnTest, EstimatesMemoryUsage) {
+  const auto empty_usage = vc_int.estimate_memory_usage();
+  for (auto i = 0; i < 100; ++i) vc_int.append(i);
+  EXPECT_GE(vc_int.estimate_memory_usage(), empty_usage + 100 * sizeof(int));
+}
+
+TEST_F(StorageValueColumnTest, ExternalValues) {
+  auto values = std::make_shared<std::vector<int>>(std::vector<int>{4, 2});
+  ValueColumn<int> column(Span<int>{*values}, values);
+  EXPECT_TRUE(column.has_external_values());
+  EXPECT_EQ(column.values().data(), values->data());
+  EXPECT_EQ(column.size(), 2u);
+  EXPECT_EQ(column[1], AllTypeVariant{2});
+
+  // Appending copies the values, the owner is not modified
+  column.append(7);
+  EXPECT_FALSE(column.has_external_values());
+  EXPECT_EQ(std::vector<int>(column.values().begin(), column.values().end()), (std::vector<int>{4, 2, 7}));
+  EXPECT_EQ(values->size(), 2u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,212 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/storage/write_ahead_log.hpp"
+
+namespace opossum {
+
+class StorageWriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override { _remove_files(); }
+
+  void TearDown() override { _remove_files(); }
+
+  void _remove_files() {
+    for (const auto& file_name : {"/wal.log", "/checkpoint.bin", "/checkpoint.bin.tmp"}) {
+      std::remove((_directory + file_name).c_str());
+    }
+    rmdir(_directory.c_str());
+  }
+
+  // simulates a restart by recovering the tables from the files only
+  std::shared_ptr<Table> _recover_table(const std::string& name) {
+    StorageManager::reset();
+    WriteAheadLog log(_directory);
+    return StorageManager::get().get_table(name);
+  }
+
+  std::shared_ptr<Table> _expected_table(const int row_count) {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto value = 1; value <= row_count; ++value) table->append({value, std::to_string(value)});
+    return table;
+  }
+
+  const std::string _directory = "write_ahead_log_test";
+};
+
+TEST_F(StorageWriteAheadLogTest, RecoversLoggedChanges) {
+  {
+    WriteAheadLog log(_directory);
+    log.add_table("t", _expected_table(1));
+    log.append("t", {2, "2"});
+    log.append_rows("t", {{3, "3"}, {4, "4"}});
+    EXPECT_TABLE_EQ(StorageManager::get().get_table("t"), _expected_table(4));
+
+    log.add_table("dropped", _expected_table(1));
+    log.drop_table("dropped");
+  }
+
+  const auto recovered = _recover_table("t");
+  EXPECT_TABLE_EQ(recovered, _expected_table(4));
+  EXPECT_EQ(recovered->chunk_count(), 2u);
+  EXPECT_FALSE(StorageManager::get().has_table("dropped"));
+}
+
+TEST_F(StorageWriteAheadLogTest, EmplacesChunks) {
+  {
+    WriteAheadLog log(_directory);
+    log.add_table("t", _expected_table(2));
+
+    Chunk chunk;
+    chunk.add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{3, 4}));
+    EXPECT_THROW(log.emplace_chunk("t", std::move(chunk)), std::exception);
+
+    chunk = Chunk();
+    chunk.add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{3, 4}));
+    chunk.add_column(std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"3", "4"}));
+    log.emplace_chunk("t", std::move(chunk));
+  }
+
+  const auto recovered = _recover_table("t");
+  EXPECT_TABLE_EQ(recovered, _expected_table(4));
+  EXPECT_EQ(recovered->chunk_count(), 2u);
+}
+
+TEST_F(StorageWriteAheadLogTest, RecoversFromCheckpoint) {
+  {
+    WriteAheadLog log(_directory);
+    log.add_table("t", _expected_table(2));
+    log.checkpoint();
+    log.append("t", {3, "3"});
+
+    // Changes that are not logged are made durable by the checkpoint, too
+    StorageManager::get().add_table("unlogged", _expected_table(1));
+    log.checkpoint();
+    log.append("t", {4, "4"});
+  }
+
+  EXPECT_TABLE_EQ(_recover_table("t"), _expected_table(4));
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("unlogged"), _expected_table(1));
+}
+
+TEST_F(StorageWriteAheadLogTest, WritesCheckpointsPeriodically) {
+  {
+    WriteAheadLog log(_directory);
+    log.set_checkpoint_interval(1);
+    log.add_table("t", _expected_table(1));
+    log.append("t", {2, "2"});
+  }
+  EXPECT_EQ(std::ifstream(_directory + "/wal.log", std::ios::ate).tellg(), 0);
+  EXPECT_TABLE_EQ(_recover_table("t"), _expected_table(2));
+}
+
+TEST_F(StorageWriteAheadLogTest, DiscardsPartialRecords) {
+  {
+    WriteAheadLog log(_directory);
+    log.add_table("t", _expected_table(1));
+    log.append("t", {2, "2"});
+    log.append("t", {3, "3"});
+  }
+
+  // Cut off the last record as if the system crashed while it was written
+  const auto log_file_name = _directory + "/wal.log";
+  const auto log_size = static_cast<size_t>(std::ifstream(log_file_name, std::ios::ate).tellg());
+  ASSERT_EQ(truncate(log_file_name.c_str(), log_size - 3), 0);
+
+  EXPECT_TABLE_EQ(_recover_table("t"), _expected_table(2));
+
+  // The log continues after the last complete record
+  {
+    WriteAheadLog log(_directory);
+    log.append("t", {3, "3"});
+  }
+  EXPECT_TABLE_EQ(_recover_table("t"), _expected_table(3));
+}
+
+TEST_F(StorageWriteAheadLogTest, GroupCommit) {
+  constexpr auto thread_count = 8;
+  constexpr auto rows_per_thread = 50;
+  {
+    WriteAheadLog log(_directory);
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    log.add_table("t", table);
+    log.set_commit_delay(std::chrono::milliseconds(1));
+
+    std::vector<std::thread> threads;
+    for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+      threads.emplace_back([&, thread_index]() {
+        for (auto row = 0; row < rows_per_thread; ++row) log.append("t", {thread_index * rows_per_thread + row});
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Each thread waits for its record to be synced before it appends the next one, which the others share
+    EXPECT_LT(log.sync_count(), static_cast<uint64_t>(thread_count * rows_per_thread));
+    EXPECT_GE(log.sync_count(), static_cast<uint64_t>(rows_per_thread));
+  }
+
+  EXPECT_EQ(_recover_table("t")->row_count(), static_cast<uint64_t>(thread_count * rows_per_thread));
+}
+
+TEST_F(StorageWriteAheadLogTest, FailsAfterFailedWrite) {
+  // Lets the writes of the log fail by replacing its file with /dev/full
+  class FailingWriteAheadLog : public WriteAheadLog {
+   public:
+    using WriteAheadLog::WriteAheadLog;
+
+    void fail_writes() {
+      const auto file_descriptor = open("/dev/full", O_WRONLY);
+      ASSERT_NE(file_descriptor, -1);
+      ASSERT_NE(dup2(file_descriptor, _file_descriptor), -1);
+      close(file_descriptor);
+    }
+  };
+
+  {
+    FailingWriteAheadLog log(_directory);
+    log.add_table("t", _expected_table(1));
+    log.fail_writes();
+
+    // Records of threads that wait for the failed write are not reported as durable
+    log.set_commit_delay(std::chrono::milliseconds(50));
+    std::vector<std::thread> threads;
+    std::atomic<int> failure_count{0};
+    for (auto value = 2; value <= 3; ++value) {
+      threads.emplace_back([&, value]() {
+        try {
+          log.append("t", {value, std::to_string(value)});
+        } catch (const std::exception&) {
+          ++failure_count;
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(failure_count, 2);
+
+    EXPECT_THROW(log.append("t", {4, "4"}), std::exception);
+    EXPECT_THROW(log.checkpoint(), std::exception);
+  }
+
+  EXPECT_TABLE_EQ(_recover_table("t"), _expected_table(1));
+}
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#include <random>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/block_compression.hpp"
+
+namespace opossum {
+
+class BlockCompressionTest : public BaseTest {
+ protected:
+  static std::string _round_trip(const std::string& data) {
+    const auto block = compress_block(data.data(), data.size());
+    std::string decompressed(data.size(), '\0');
+    decompress_block(block.data(), block.size(), decompressed.data(), decompressed.size());
+    return decompressed;
+  }
+};
+
+TEST_F(BlockCompressionTest, CompressesRepeatedData) {
+  std::string data;
+  for (auto index = 0; index < 10000; ++index) data += "value " + std::to_string(index % 100) + ";";
+
+  EXPECT_LT(compress_block(data.data(), data.size()).size(), data.size() / 10);
+  EXPECT_EQ(_round_trip(data), data);
+}
+
+TEST_F(BlockCompressionTest, RoundTripsIncompressibleData) {
+  std::mt19937 generator(42);
+  std::string data(100000, '\0');
+  for (auto& byte : data) byte = static_cast<char>(generator());
+
+  // incompressible data only grows by the tokens and the extended literal length
+  EXPECT_LE(compress_block(data.data(), data.size()).size(), data.size() + data.size() / 255 + 16);
+  EXPECT_EQ(_round_trip(data), data);
+}
+
+TEST_F(BlockCompressionTest, RoundTripsShortData) {
+  for (const auto& data : {std::string(), std::string("a"), std::string("abcd"), std::string("abcdabcd")}) {
+    EXPECT_EQ(_round_trip(data), data);
+  }
+}
+
+TEST_F(BlockCompressionTest, RoundTripsOverlappingMatches) {
+  // runs of a single byte are matches that overlap with their own output
+  const auto data = std::string(1000, 'x') + "y" + std::string(70000, '\0') + "abababababababababab";
+  EXPECT_LT(compress_block(data.data(), data.size()).size(), 500u);
+  EXPECT_EQ(_round_trip(data), data);
+}
+
+TEST_F(BlockCompressionTest, RejectsCorruptBlocks) {
+  const auto data = std::string(1000, 'x') + "some literals";
+  const auto block = compress_block(data.data(), data.size());
+  std::string out(data.size(), '\0');
+
+  EXPECT_THROW(decompress_block(block.data(), block.size() - 1, out.data(), out.size()), std::exception);
+  EXPECT_THROW(decompress_block(block.data(), block.size(), out.data(), out.size() - 1), std::exception);
+
+  // a match that reaches before the start of the output
+  const char invalid_distance[] = {0x10, 'x', 0x08, 0x00};
+  EXPECT_THROW(decompress_block(invalid_distance, sizeof(invalid_distance), out.data(), 5), std::exception);
+}
+
+}  // namespace opossum
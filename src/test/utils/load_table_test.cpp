@@ -0,0 +1,97 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class LoadTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _expected_table = std::make_shared<Table>();
+    _expected_table->add_column("a", "int");
+    _expected_table->add_column("b", "long");
+    _expected_table->add_column("c", "float");
+    _expected_table->add_column("d", "double");
+    _expected_table->add_column("e", "string");
+    _expected_table->append({1, int64_t{10000000000}, 1.5f, 2.25, "one"});
+    _expected_table->append({-2, int64_t{-20}, 0.0f, 3.0, "two words"});
+    _expected_table->append({3, int64_t{30}, -3.5f, 1000.0, ""});
+    _expected_table->append({4, int64_t{40}, 4.25f, -0.5, "four"});
+    _expected_table->append({5, int64_t{50}, 5.0f, 5.125, "five"});
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  void _write_file(const std::string& content) { std::ofstream(_file_name) << content; }
+
+  const std::string _file_name = "load_table_test.tbl";
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(LoadTableTest, LoadsAllTypes) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 2);
+  EXPECT_TABLE_EQ(table, _expected_table, true);
+
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<int64_t>>(table->get_chunk(ChunkID{0}).get_column(ColumnID{1})));
+}
+
+TEST_F(LoadTableTest, LinesSpanningBlocks) {
+  CurrentScheduler::set(std::make_shared<WorkStealingScheduler>(4));
+
+  // Blocks much smaller than a line and a chunk, and a block size that does not divide the file size
+  for (const auto block_size : {1u, 7u, 64u}) {
+    const auto table = load_table("src/test/tables/all_types.tbl", 2, block_size);
+    EXPECT_TABLE_EQ(table, _expected_table, true);
+    EXPECT_EQ(table->chunk_count(), 3u);
+  }
+}
+
+TEST_F(LoadTableTest, UnlimitedChunkSize) {
+  const auto table = load_table("src/test/tables/all_types.tbl", 0, 16);
+  EXPECT_TABLE_EQ(table, _expected_table, true);
+  EXPECT_EQ(table->chunk_count(), 1u);
+}
+
+TEST_F(LoadTableTest, LastLineWithoutLineBreak) {
+  _write_file("a|b\nint|string\n1|x\n2|y");
+  const auto table = load_table(_file_name, 1);
+  EXPECT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).get_column(ColumnID{1})->operator[](0), AllTypeVariant{"y"});
+}
+
+TEST_F(LoadTableTest, EmptyTable) {
+  _write_file("a|b\nint|string\n");
+  const auto table = load_table(_file_name, 2);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->chunk_count(), 1u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).col_count(), 2u);
+}
+
+TEST_F(LoadTableTest, InvalidValues) {
+  _write_file("a|b\nint|string\n1x|x\n");
+  EXPECT_THROW(load_table(_file_name, 2), std::exception);
+
+  _write_file("a|b\nint|string\n1\n");
+  EXPECT_THROW(load_table(_file_name, 2), std::exception);
+
+  // Numbers are parsed strictly, and must fit into their type
+  for (const auto& value : {" 1", "+1", "", "3000000000", "1.5"}) {
+    _write_file(std::string("a|b\nint|string\n") + value + "|x\n");
+    EXPECT_THROW(load_table(_file_name, 2), std::exception) << value;
+  }
+
+  EXPECT_THROW(load_table("does_not_exist.tbl", 2), std::exception);
+}
+
+}  // namespace opossum
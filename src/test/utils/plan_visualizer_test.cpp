@@ -0,0 +1,74 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "storage/table.hpp"
+#include "utils/plan_visualizer.hpp"
+
+namespace opossum {
+
+class PlanVisualizerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    for (auto i = 0; i < 10; ++i) table->append({i});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(PlanVisualizerTest, ExportsDot) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{0}});
+  auto sort = std::make_shared<Sort>(projection, ColumnID{0});
+  projection->execute();
+  sort->execute();
+
+  std::ostringstream dot;
+  PlanVisualizer::export_dot(sort, dot);
+  const auto graph = dot.str();
+
+  EXPECT_EQ(graph.find("digraph plan {\n"), 0u);
+  EXPECT_NE(graph.find("op0 [label=\"Sort\\n"), std::string::npos);
+  EXPECT_NE(graph.find("op2 [label=\"TableScan\\npipelined\", style=dashed];"), std::string::npos);
+  EXPECT_NE(graph.find("op1 -> op0 [label=\"5 rows\"];"), std::string::npos);
+  EXPECT_NE(graph.find("op2 -> op1;"), std::string::npos);
+  EXPECT_NE(graph.find("op3 -> op2 [label=\"10 rows\"];"), std::string::npos);
+}
+
+TEST_F(PlanVisualizerTest, ExportsJson) {
+  // The wrapper is read twice, but is a single node
+  auto left_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3);
+  auto right_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  auto union_all = std::make_shared<UnionAll>(left_scan, right_scan);
+  left_scan->execute();
+  right_scan->execute();
+
+  std::ostringstream json;
+  PlanVisualizer::export_json(union_all, json);
+  const auto document = json.str();
+
+  EXPECT_EQ(document.find("{\"operators\": [{\"id\": 0, \"name\": \"UnionAll\", \"executed\": false, "
+                          "\"pipelined\": false, \"walltime_ns\": 0,"),
+            0u);
+  EXPECT_NE(document.find("{\"id\": 2, \"name\": \"TableWrapper\", \"executed\": true"), std::string::npos);
+  EXPECT_NE(document.find("\"output_rows\": 6,"), std::string::npos);
+  EXPECT_NE(document.find("\"edges\": [{\"from\": 2, \"to\": 1, \"rows\": 10}, {\"from\": 1, \"to\": 0, \"rows\": 3}, "
+                          "{\"from\": 2, \"to\": 3, \"rows\": 10}, {\"from\": 3, \"to\": 0, \"rows\": 6}]}"),
+            std::string::npos);
+}
+
+}  // namespace opossum